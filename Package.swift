@@ -45,6 +45,12 @@ let package = Package(
             ]
         ),
 
+        // Benchmarks (run with `swift run -c release ResvgBenchmarks`)
+        .executableTarget(
+            name: "ResvgBenchmarks",
+            dependencies: ["Resvg"]
+        ),
+
         // Tests
         .testTarget(
             name: "ResvgTests",
@@ -42,6 +42,117 @@ git clone --depth 1 --branch "v$ResvgVersion" `
 Write-Host ""
 Write-Host "=== Applying SVG export patch ==="
 
+# Interruptible rendering walks resvg's node renderer directly.
+$ResvgLibPath = Join-Path $BuildDir "resvg\crates\resvg\src\lib.rs"
+(Get-Content $ResvgLibPath) -replace '^mod render;$', 'pub mod render;' |
+    Set-Content $ResvgLibPath -Encoding UTF8
+
+# Recoloring edits paints on a cloned usvg tree.
+$UsvgPatch = @'
+// =============================================================================
+// Paint Editing (added by swift-resvg)
+// =============================================================================
+//
+// Mutable access used by the c-api to recolor a cloned tree without parsing.
+
+impl Tree {
+    /// The root group, for editing a cloned tree.
+    pub fn swift_resvg_root_mut(&mut self) -> &mut Group {
+        &mut self.root
+    }
+
+    /// Replaces gradients in the lists the SVG writer emits as definitions.
+    pub fn swift_resvg_replace_paint_servers(&mut self, replaced: &[(Paint, Paint)]) {
+        for (old, new) in replaced {
+            match (old, new) {
+                (Paint::LinearGradient(old), Paint::LinearGradient(new)) => {
+                    for lg in self.linear_gradients.iter_mut().filter(|lg| std::sync::Arc::ptr_eq(lg, old)) {
+                        *lg = new.clone();
+                    }
+                }
+                (Paint::RadialGradient(old), Paint::RadialGradient(new)) => {
+                    for rg in self.radial_gradients.iter_mut().filter(|rg| std::sync::Arc::ptr_eq(rg, old)) {
+                        *rg = new.clone();
+                    }
+                }
+                _ => {}
+            }
+        }
+    }
+}
+
+impl Group {
+    /// The group's children, for editing a cloned tree.
+    pub fn swift_resvg_children_mut(&mut self) -> &mut Vec<Node> {
+        &mut self.children
+    }
+}
+
+impl crate::Text {
+    /// The text as paths, for editing a cloned tree.
+    pub fn swift_resvg_flattened_mut(&mut self) -> &mut Group {
+        &mut self.flattened
+    }
+}
+
+impl Path {
+    /// The fill and stroke, for editing a cloned tree.
+    pub fn swift_resvg_paints_mut(&mut self) -> (Option<&mut Fill>, Option<&mut Stroke>) {
+        (self.fill.as_mut(), self.stroke.as_mut())
+    }
+}
+
+impl Fill {
+    pub fn swift_resvg_set_paint(&mut self, paint: Paint, opacity: Opacity) {
+        self.paint = paint;
+        self.opacity = opacity;
+    }
+}
+
+impl Stroke {
+    pub fn swift_resvg_set_paint(&mut self, paint: Paint, opacity: Opacity) {
+        self.paint = paint;
+        self.opacity = opacity;
+    }
+}
+
+impl Stop {
+    /// A copy at the same offset with another color and opacity.
+    pub fn swift_resvg_with_color(&self, color: Color, opacity: Opacity) -> Self {
+        Stop { color, opacity, ..*self }
+    }
+}
+
+impl BaseGradient {
+    fn swift_resvg_with_stops(&self, stops: Vec<Stop>) -> Self {
+        BaseGradient {
+            id: self.id.clone(),
+            units: self.units,
+            transform: self.transform,
+            spread_method: self.spread_method,
+            stops,
+        }
+    }
+}
+
+impl LinearGradient {
+    /// A copy with the same ID and geometry and other stops.
+    pub fn swift_resvg_with_stops(&self, stops: Vec<Stop>) -> Self {
+        LinearGradient { base: self.base.swift_resvg_with_stops(stops), ..*self }
+    }
+}
+
+impl RadialGradient {
+    /// A copy with the same ID and geometry and other stops.
+    pub fn swift_resvg_with_stops(&self, stops: Vec<Stop>) -> Self {
+        RadialGradient { base: self.base.swift_resvg_with_stops(stops), ..*self }
+    }
+}
+'@
+
+$UsvgTreePath = Join-Path $BuildDir "resvg\crates\usvg\src\tree\mod.rs"
+Add-Content -Path $UsvgTreePath -Value $UsvgPatch -Encoding UTF8
+
 $RustPatch = @'
 
 // =============================================================================
@@ -1348,12 +1459,1935 @@ pub extern "C" fn resvg_text_flattened(text: *const usvg::Text) -> *const usvg::
     let text = unsafe { &*text };
     text.flattened() as *const usvg::Group
 }
-'@
 
-$LibRsPath = Join-Path $BuildDir "resvg\crates\c-api\lib.rs"
-Add-Content -Path $LibRsPath -Value $RustPatch -Encoding UTF8
+// =============================================================================
+// Bulk Path Data API (added by swift-resvg)
+// =============================================================================
 
-Write-Host "Rust patch applied successfully"
+/// Copies the verbs and points of a tiny-skia path into caller-provided buffers.
+///
+/// Verbs use the `resvg_path_segment_type` values. Points are written as
+/// interleaved x/y pairs in the order the verbs consume them.
+/// Returns false if a buffer is too small.
+fn swift_resvg_copy_path_data(
+    data: &resvg::tiny_skia::Path,
+    verbs: *mut u8,
+    verbs_len: usize,
+    points: *mut f32,
+    points_len: usize,
+) -> bool {
+    let verb_count = data.verbs().len();
+    let point_count = data.points().len() * 2;
+    if verb_count > verbs_len || point_count > points_len {
+        return false;
+    }
+    if (verb_count > 0 && verbs.is_null()) || (point_count > 0 && points.is_null()) {
+        return false;
+    }
+
+    let mut vi = 0usize;
+    let mut pi = 0usize;
+    let push_point = |p: resvg::tiny_skia::Point, pi: &mut usize| {
+        unsafe {
+            *points.add(*pi) = p.x;
+            *points.add(*pi + 1) = p.y;
+        }
+        *pi += 2;
+    };
+
+    for segment in data.segments() {
+        let verb = match segment {
+            resvg::tiny_skia::PathSegment::MoveTo(p) => {
+                push_point(p, &mut pi);
+                resvg_path_segment_type::RESVG_PATH_SEG_MOVE_TO
+            }
+            resvg::tiny_skia::PathSegment::LineTo(p) => {
+                push_point(p, &mut pi);
+                resvg_path_segment_type::RESVG_PATH_SEG_LINE_TO
+            }
+            resvg::tiny_skia::PathSegment::QuadTo(p1, p) => {
+                push_point(p1, &mut pi);
+                push_point(p, &mut pi);
+                resvg_path_segment_type::RESVG_PATH_SEG_QUAD_TO
+            }
+            resvg::tiny_skia::PathSegment::CubicTo(p1, p2, p) => {
+                push_point(p1, &mut pi);
+                push_point(p2, &mut pi);
+                push_point(p, &mut pi);
+                resvg_path_segment_type::RESVG_PATH_SEG_CUBIC_TO
+            }
+            resvg::tiny_skia::PathSegment::Close => resvg_path_segment_type::RESVG_PATH_SEG_CLOSE,
+        };
+        unsafe { *verbs.add(vi) = verb as u8; }
+        vi += 1;
+    }
+    true
+}
+
+/// Returns the number of points in a path's data.
+///
+/// MoveTo and LineTo consume one point, QuadTo two, CubicTo three and Close none.
+#[no_mangle]
+pub extern "C" fn resvg_path_data_points_len(path: *const usvg::Path) -> usize {
+    if path.is_null() {
+        return 0;
+    }
+    let path = unsafe { &*path };
+    path.data().points().len()
+}
+
+/// Copies all verbs and points of a path in a single call.
+///
+/// `verbs` must hold `resvg_path_data_len` bytes and `points` must hold
+/// `resvg_path_data_points_len * 2` floats (interleaved x/y).
+/// Returns false if the path is NULL or a buffer is too small.
+#[no_mangle]
+pub extern "C" fn resvg_path_data_copy(
+    path: *const usvg::Path,
+    verbs: *mut u8,
+    verbs_len: usize,
+    points: *mut f32,
+    points_len: usize,
+) -> bool {
+    if path.is_null() {
+        return false;
+    }
+    let path = unsafe { &*path };
+    swift_resvg_copy_path_data(path.data(), verbs, verbs_len, points, points_len)
+}
+
+// =============================================================================
+// Tree Snapshot API (added by swift-resvg)
+// =============================================================================
+
+/// Index value meaning "no node" or "no paint" in a snapshot.
+const SWIFT_RESVG_SNAPSHOT_NONE: u32 = u32::MAX;
+
+/// Snapshot node flag: the path or image is visible.
+const SWIFT_RESVG_SNAPSHOT_VISIBLE: u8 = 1;
+/// Snapshot node flag: the group has a mask.
+const SWIFT_RESVG_SNAPSHOT_HAS_MASK: u8 = 2;
+/// Snapshot node flag: the group has a clip path.
+const SWIFT_RESVG_SNAPSHOT_HAS_CLIP_PATH: u8 = 4;
+
+/// One node of a tree snapshot.
+#[repr(C)]
+#[derive(Copy, Clone, Debug)]
+pub struct resvg_snapshot_node {
+    pub parent: u32,
+    pub first_child: u32,
+    pub next_sibling: u32,
+    pub id_offset: u32,
+    pub id_len: u32,
+    pub fill: u32,
+    pub stroke: u32,
+    pub kind: u8,
+    pub flags: u8,
+    pub reserved: [u8; 2],
+    pub opacity: f32,
+    pub transform: resvg_transform,
+    pub bbox: resvg_rect,
+}
+
+/// One fill or stroke of a tree snapshot.
+#[repr(C)]
+#[derive(Copy, Clone, Debug)]
+pub struct resvg_snapshot_paint {
+    pub paint_type: u8,
+    pub reserved: [u8; 3],
+    pub color: resvg_color,
+    pub opacity: f32,
+    pub width: f32,
+}
+
+/// A flat copy of the render tree in preorder.
+pub struct resvg_tree_snapshot {
+    nodes: Vec<resvg_snapshot_node>,
+    paints: Vec<resvg_snapshot_paint>,
+    strings: Vec<u8>,
+}
+
+impl resvg_tree_snapshot {
+    fn push(
+        &mut self,
+        parent: u32,
+        kind: resvg_node_type,
+        id: &str,
+        t: usvg::Transform,
+        r: usvg::Rect,
+    ) -> u32 {
+        let index = self.nodes.len() as u32;
+        let id_offset = self.strings.len() as u32;
+        self.strings.extend_from_slice(id.as_bytes());
+        self.nodes.push(resvg_snapshot_node {
+            parent,
+            first_child: SWIFT_RESVG_SNAPSHOT_NONE,
+            next_sibling: SWIFT_RESVG_SNAPSHOT_NONE,
+            id_offset,
+            id_len: id.len() as u32,
+            fill: SWIFT_RESVG_SNAPSHOT_NONE,
+            stroke: SWIFT_RESVG_SNAPSHOT_NONE,
+            kind: kind as u8,
+            flags: 0,
+            reserved: [0; 2],
+            opacity: 1.0,
+            transform: resvg_transform { a: t.sx, b: t.ky, c: t.kx, d: t.sy, e: t.tx, f: t.ty },
+            bbox: resvg_rect { x: r.x(), y: r.y(), width: r.width(), height: r.height() },
+        });
+        index
+    }
+
+    fn push_paint(&mut self, paint: &usvg::Paint, opacity: f32, width: f32) -> u32 {
+        let (paint_type, color) = match paint {
+            usvg::Paint::Color(c) => (
+                resvg_paint_type::RESVG_PAINT_COLOR,
+                resvg_color { r: c.red, g: c.green, b: c.blue, a: 255 },
+            ),
+            usvg::Paint::LinearGradient(_) => (
+                resvg_paint_type::RESVG_PAINT_LINEAR_GRADIENT,
+                resvg_color { r: 0, g: 0, b: 0, a: 255 },
+            ),
+            usvg::Paint::RadialGradient(_) => (
+                resvg_paint_type::RESVG_PAINT_RADIAL_GRADIENT,
+                resvg_color { r: 0, g: 0, b: 0, a: 255 },
+            ),
+            usvg::Paint::Pattern(_) => (
+                resvg_paint_type::RESVG_PAINT_PATTERN,
+                resvg_color { r: 0, g: 0, b: 0, a: 255 },
+            ),
+        };
+        self.paints.push(resvg_snapshot_paint {
+            paint_type: paint_type as u8,
+            reserved: [0; 3],
+            color,
+            opacity,
+            width,
+        });
+        (self.paints.len() - 1) as u32
+    }
+
+    fn push_group(&mut self, group: &usvg::Group, index: u32) {
+        let node = &mut self.nodes[index as usize];
+        node.opacity = group.opacity().get();
+        if group.mask().is_some() {
+            node.flags |= SWIFT_RESVG_SNAPSHOT_HAS_MASK;
+        }
+        if group.clip_path().is_some() {
+            node.flags |= SWIFT_RESVG_SNAPSHOT_HAS_CLIP_PATH;
+        }
+
+        let mut previous = SWIFT_RESVG_SNAPSHOT_NONE;
+        for child in group.children() {
+            let kind = match child {
+                usvg::Node::Group(_) => resvg_node_type::RESVG_NODE_GROUP,
+                usvg::Node::Path(_) => resvg_node_type::RESVG_NODE_PATH,
+                usvg::Node::Image(_) => resvg_node_type::RESVG_NODE_IMAGE,
+                usvg::Node::Text(_) => resvg_node_type::RESVG_NODE_TEXT,
+            };
+            let child_index = self.push(index, kind, child.id(), child.abs_transform(), child.abs_bounding_box());
+            if previous == SWIFT_RESVG_SNAPSHOT_NONE {
+                self.nodes[index as usize].first_child = child_index;
+            } else {
+                self.nodes[previous as usize].next_sibling = child_index;
+            }
+            previous = child_index;
+
+            match child {
+                usvg::Node::Group(g) => self.push_group(g, child_index),
+                usvg::Node::Path(p) => {
+                    let fill = p.fill().map_or(SWIFT_RESVG_SNAPSHOT_NONE, |f| {
+                        self.push_paint(f.paint(), f.opacity().get(), 0.0)
+                    });
+                    let stroke = p.stroke().map_or(SWIFT_RESVG_SNAPSHOT_NONE, |s| {
+                        self.push_paint(s.paint(), s.opacity().get(), s.width().get())
+                    });
+                    let node = &mut self.nodes[child_index as usize];
+                    node.fill = fill;
+                    node.stroke = stroke;
+                    if p.is_visible() {
+                        node.flags |= SWIFT_RESVG_SNAPSHOT_VISIBLE;
+                    }
+                }
+                usvg::Node::Image(i) => {
+                    if i.is_visible() {
+                        self.nodes[child_index as usize].flags |= SWIFT_RESVG_SNAPSHOT_VISIBLE;
+                    }
+                }
+                usvg::Node::Text(_) => {}
+            }
+        }
+    }
+}
+
+/// Copies the whole render tree into flat node, paint and string tables.
+///
+/// Nodes are in preorder with the root group at index 0. Returns NULL if the
+/// tree is NULL. Must be freed via `resvg_tree_snapshot_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_tree_snapshot_create(tree: *const resvg_render_tree) -> *mut resvg_tree_snapshot {
+    if tree.is_null() {
+        return std::ptr::null_mut();
+    }
+    let tree = unsafe { &*tree };
+    let root = tree.0.root();
+
+    let mut snapshot = resvg_tree_snapshot { nodes: Vec::new(), paints: Vec::new(), strings: Vec::new() };
+    let index = snapshot.push(
+        SWIFT_RESVG_SNAPSHOT_NONE,
+        resvg_node_type::RESVG_NODE_GROUP,
+        root.id(),
+        root.abs_transform(),
+        root.abs_bounding_box(),
+    );
+    snapshot.push_group(root, index);
+    Box::into_raw(Box::new(snapshot))
+}
+
+/// Frees a snapshot created by `resvg_tree_snapshot_create`.
+#[no_mangle]
+pub extern "C" fn resvg_tree_snapshot_destroy(snapshot: *mut resvg_tree_snapshot) {
+    if !snapshot.is_null() {
+        unsafe { let _ = Box::from_raw(snapshot); }
+    }
+}
+
+/// Returns the node table of a snapshot and its length in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_tree_snapshot_nodes(
+    snapshot: *const resvg_tree_snapshot,
+    len: *mut usize,
+) -> *const resvg_snapshot_node {
+    if snapshot.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let snapshot = unsafe { &*snapshot };
+    unsafe { *len = snapshot.nodes.len(); }
+    snapshot.nodes.as_ptr()
+}
+
+/// Returns the paint table of a snapshot and its length in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_tree_snapshot_paints(
+    snapshot: *const resvg_tree_snapshot,
+    len: *mut usize,
+) -> *const resvg_snapshot_paint {
+    if snapshot.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let snapshot = unsafe { &*snapshot };
+    unsafe { *len = snapshot.paints.len(); }
+    snapshot.paints.as_ptr()
+}
+
+/// Returns the ID string blob of a snapshot and its length in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_tree_snapshot_strings(
+    snapshot: *const resvg_tree_snapshot,
+    len: *mut usize,
+) -> *const u8 {
+    if snapshot.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let snapshot = unsafe { &*snapshot };
+    unsafe { *len = snapshot.strings.len(); }
+    snapshot.strings.as_ptr()
+}
+
+// =============================================================================
+// Node Query API (added by swift-resvg)
+// =============================================================================
+
+/// A list of borrowed node pointers collected from a render tree.
+pub struct resvg_node_list(Vec<*const usvg::Node>);
+
+fn swift_resvg_collect_nodes(group: &usvg::Group, type_mask: u32, out: &mut Vec<*const usvg::Node>) {
+    for child in group.children() {
+        let kind = match child {
+            usvg::Node::Group(_) => resvg_node_type::RESVG_NODE_GROUP,
+            usvg::Node::Path(_) => resvg_node_type::RESVG_NODE_PATH,
+            usvg::Node::Image(_) => resvg_node_type::RESVG_NODE_IMAGE,
+            usvg::Node::Text(_) => resvg_node_type::RESVG_NODE_TEXT,
+        };
+        if type_mask & (1 << kind as u32) != 0 {
+            out.push(child as *const usvg::Node);
+        }
+        if let usvg::Node::Group(g) = child {
+            swift_resvg_collect_nodes(g, type_mask, out);
+        }
+    }
+}
+
+/// Collects every node below the root whose type is in `type_mask`, in preorder.
+///
+/// Bit `1 << resvg_node_type` selects a type. The root group is not included.
+/// Returns NULL if the tree is NULL. Must be freed via `resvg_node_list_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_tree_collect_nodes(tree: *const resvg_render_tree, type_mask: u32) -> *mut resvg_node_list {
+    if tree.is_null() {
+        return std::ptr::null_mut();
+    }
+    let tree = unsafe { &*tree };
+    let mut nodes = Vec::new();
+    swift_resvg_collect_nodes(tree.0.root(), type_mask, &mut nodes);
+    Box::into_raw(Box::new(resvg_node_list(nodes)))
+}
+
+/// Returns the node pointers of a list and their count in `len`.
+/// The pointers are valid as long as the tree is alive.
+#[no_mangle]
+pub extern "C" fn resvg_node_list_items(list: *const resvg_node_list, len: *mut usize) -> *const *const usvg::Node {
+    if list.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let list = unsafe { &*list };
+    unsafe { *len = list.0.len(); }
+    list.0.as_ptr()
+}
+
+/// Frees a list created by `resvg_tree_collect_nodes`.
+#[no_mangle]
+pub extern "C" fn resvg_node_list_destroy(list: *mut resvg_node_list) {
+    if !list.is_null() {
+        unsafe { let _ = Box::from_raw(list); }
+    }
+}
+
+/// Returns the ID of any node. Returns the length in `len`.
+/// The returned string is not NUL-terminated and is valid as long as the tree is alive.
+#[no_mangle]
+pub extern "C" fn resvg_node_id(node: *const usvg::Node, len: *mut usize) -> *const std::os::raw::c_char {
+    if node.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let node = unsafe { &*node };
+    let id = node.id();
+    unsafe { *len = id.len(); }
+    id.as_ptr() as *const std::os::raw::c_char
+}
+
+// =============================================================================
+// Streaming SVG Export (added by swift-resvg)
+// =============================================================================
+
+/// Indentation value: no line breaks or indentation.
+const SWIFT_RESVG_INDENT_NONE: i32 = -1;
+/// Indentation value: one tab per level.
+const SWIFT_RESVG_INDENT_TABS: i32 = -2;
+
+/// Options for SVG export, mirroring `usvg::WriteOptions`.
+#[repr(C)]
+pub struct resvg_write_options {
+    pub indent: i32,
+    pub attributes_indent: i32,
+    pub coordinates_precision: u8,
+    pub transforms_precision: u8,
+    pub use_single_quote: bool,
+    pub preserve_text: bool,
+    pub id_prefix: *const std::os::raw::c_char,
+}
+
+/// Receives one chunk of exported SVG. Returns false to stop the export.
+pub type resvg_write_callback =
+    Option<extern "C" fn(data: *const u8, len: usize, context: *mut std::ffi::c_void) -> bool>;
+
+fn swift_resvg_indent(value: i32) -> usvg::Indent {
+    match value {
+        SWIFT_RESVG_INDENT_NONE => usvg::Indent::None,
+        SWIFT_RESVG_INDENT_TABS => usvg::Indent::Tabs,
+        n => usvg::Indent::Spaces(n.clamp(0, 255) as u8),
+    }
+}
+
+/// Exports the render tree as SVG and passes it to `callback` in chunks.
+///
+/// Chunks are at most `chunk_size` bytes (0 for a single chunk) and are only
+/// valid during the call. Unlike `resvg_tree_to_svg` no C string copy is made.
+/// Returns false if an argument is NULL or the callback returned false.
+#[no_mangle]
+pub extern "C" fn resvg_tree_write_svg(
+    tree: *const resvg_render_tree,
+    options: *const resvg_write_options,
+    chunk_size: usize,
+    callback: resvg_write_callback,
+    context: *mut std::ffi::c_void,
+) -> bool {
+    if tree.is_null() || options.is_null() {
+        return false;
+    }
+    let callback = match callback {
+        Some(callback) => callback,
+        None => return false,
+    };
+    let tree = unsafe { &*tree };
+    let options = unsafe { &*options };
+
+    let id_prefix = if options.id_prefix.is_null() {
+        None
+    } else {
+        match unsafe { std::ffi::CStr::from_ptr(options.id_prefix) }.to_str() {
+            Ok(prefix) => Some(prefix.to_string()),
+            Err(_) => return false,
+        }
+    };
+    let write_options = usvg::WriteOptions {
+        id_prefix,
+        preserve_text: options.preserve_text,
+        coordinates_precision: options.coordinates_precision,
+        transforms_precision: options.transforms_precision,
+        use_single_quote: options.use_single_quote,
+        indent: swift_resvg_indent(options.indent),
+        attributes_indent: swift_resvg_indent(options.attributes_indent),
+    };
+
+    let svg = tree.0.to_string(&write_options);
+    let bytes = svg.as_bytes();
+    let chunk_size = if chunk_size == 0 { bytes.len().max(1) } else { chunk_size };
+    for chunk in bytes.chunks(chunk_size) {
+        if !callback(chunk.as_ptr(), chunk.len(), context) {
+            return false;
+        }
+    }
+    true
+}
+
+// =============================================================================
+// Encoded Output API (added by swift-resvg)
+// =============================================================================
+
+/// Output encoding enumeration
+#[repr(C)]
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub enum resvg_encoding {
+    RESVG_ENCODING_PNG = 0,
+    RESVG_ENCODING_QOI = 1,
+}
+
+/// Converts premultiplied RGBA to straight RGBA in place.
+///
+/// Uses the same expression as the Swift unpremultiply pass, so results match it.
+fn swift_resvg_demultiply(pixels: &mut [u8]) {
+    for pixel in pixels.chunks_exact_mut(4) {
+        let a = pixel[3];
+        if a != 0 && a != 255 {
+            let alpha = a as f32 / 255.0;
+            for c in &mut pixel[..3] {
+                *c = (*c as f32 / alpha).min(255.0) as u8;
+            }
+        }
+    }
+}
+
+fn swift_resvg_encode_png(pixels: &[u8], width: u32, height: u32, compression: u32) -> Option<Vec<u8>> {
+    let mut out = Vec::new();
+    {
+        let mut encoder = png::Encoder::new(&mut out, width, height);
+        encoder.set_color(png::ColorType::Rgba);
+        encoder.set_depth(png::BitDepth::Eight);
+        encoder.set_compression(match compression {
+            0 => png::Compression::Fast,
+            2 => png::Compression::Best,
+            _ => png::Compression::Default,
+        });
+        let mut writer = encoder.write_header().ok()?;
+        writer.write_image_data(pixels).ok()?;
+    }
+    Some(out)
+}
+
+/// Encodes straight RGBA pixels as QOI (https://qoiformat.org).
+fn swift_resvg_encode_qoi(pixels: &[u8], width: u32, height: u32) -> Vec<u8> {
+    let mut out = Vec::with_capacity(14 + pixels.len() / 2 + 8);
+    out.extend_from_slice(b"qoif");
+    out.extend_from_slice(&width.to_be_bytes());
+    out.extend_from_slice(&height.to_be_bytes());
+    out.push(4); // RGBA
+    out.push(0); // sRGB with linear alpha
+
+    let mut index = [[0u8; 4]; 64];
+    let mut previous = [0u8, 0, 0, 255];
+    let mut run = 0u8;
+    let count = pixels.len() / 4;
+
+    for (i, chunk) in pixels.chunks_exact(4).enumerate() {
+        let pixel = [chunk[0], chunk[1], chunk[2], chunk[3]];
+        if pixel == previous {
+            run += 1;
+            if run == 62 || i == count - 1 {
+                out.push(0xC0 | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+        if run > 0 {
+            out.push(0xC0 | (run - 1));
+            run = 0;
+        }
+
+        let hash = (pixel[0] as usize * 3 + pixel[1] as usize * 5 + pixel[2] as usize * 7 + pixel[3] as usize * 11) % 64;
+        if index[hash] == pixel {
+            out.push(hash as u8);
+        } else {
+            index[hash] = pixel;
+            if pixel[3] == previous[3] {
+                let vr = pixel[0].wrapping_sub(previous[0]) as i8;
+                let vg = pixel[1].wrapping_sub(previous[1]) as i8;
+                let vb = pixel[2].wrapping_sub(previous[2]) as i8;
+                let vg_r = vr.wrapping_sub(vg);
+                let vg_b = vb.wrapping_sub(vg);
+
+                if (-2..=1).contains(&vr) && (-2..=1).contains(&vg) && (-2..=1).contains(&vb) {
+                    out.push(0x40 | ((vr + 2) as u8) << 4 | ((vg + 2) as u8) << 2 | (vb + 2) as u8);
+                } else if (-8..=7).contains(&vg_r) && (-32..=31).contains(&vg) && (-8..=7).contains(&vg_b) {
+                    out.push(0x80 | (vg + 32) as u8);
+                    out.push(((vg_r + 8) as u8) << 4 | (vg_b + 8) as u8);
+                } else {
+                    out.push(0xFE);
+                    out.extend_from_slice(&pixel[..3]);
+                }
+            } else {
+                out.push(0xFF);
+                out.extend_from_slice(&pixel);
+            }
+        }
+        previous = pixel;
+    }
+
+    out.extend_from_slice(&[0, 0, 0, 0, 0, 0, 0, 1]);
+    out
+}
+
+/// Renders a tree and encodes the result without returning raw pixels.
+///
+/// `compression` applies to PNG: 0 = fast, 1 = default, 2 = best.
+/// Returns NULL on error. Must be freed via `resvg_encoded_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_render_encoded(
+    tree: *const resvg_render_tree,
+    transform: resvg_transform,
+    width: u32,
+    height: u32,
+    encoding: resvg_encoding,
+    compression: u32,
+    len: *mut usize,
+) -> *mut u8 {
+    if tree.is_null() || len.is_null() {
+        return std::ptr::null_mut();
+    }
+    let tree = unsafe { &*tree };
+    let mut pixmap = match resvg::tiny_skia::Pixmap::new(width, height) {
+        Some(pixmap) => pixmap,
+        None => return std::ptr::null_mut(),
+    };
+    let t = resvg::tiny_skia::Transform::from_row(
+        transform.a, transform.b, transform.c, transform.d, transform.e, transform.f,
+    );
+    resvg::render(&tree.0, t, &mut pixmap.as_mut());
+
+    let mut pixels = pixmap.take();
+    swift_resvg_demultiply(&mut pixels);
+    let encoded = match encoding {
+        resvg_encoding::RESVG_ENCODING_PNG => swift_resvg_encode_png(&pixels, width, height, compression),
+        resvg_encoding::RESVG_ENCODING_QOI => Some(swift_resvg_encode_qoi(&pixels, width, height)),
+    };
+    drop(pixels);
+
+    match encoded {
+        Some(bytes) => {
+            let bytes = bytes.into_boxed_slice();
+            unsafe { *len = bytes.len(); }
+            Box::into_raw(bytes) as *mut u8
+        }
+        None => std::ptr::null_mut(),
+    }
+}
+
+/// Frees data returned by `resvg_render_encoded`.
+#[no_mangle]
+pub extern "C" fn resvg_encoded_destroy(data: *mut u8, len: usize) {
+    if !data.is_null() {
+        unsafe { let _ = Box::from_raw(std::ptr::slice_from_raw_parts_mut(data, len)); }
+    }
+}
+
+// =============================================================================
+// Node Layer Bounds (added by swift-resvg)
+// =============================================================================
+
+/// Returns a node's layer bounding box in canvas coordinates by ID.
+///
+/// This is the box `resvg_render_node` moves to the pixmap origin: the stroke
+/// bounding box extended by filters. Returns false if an argument is NULL,
+/// the ID is empty, not UTF-8 or unknown, or the node renders nothing.
+#[no_mangle]
+pub extern "C" fn resvg_get_node_layer_bbox(
+    tree: *const resvg_render_tree,
+    id: *const std::os::raw::c_char,
+    bbox: *mut resvg_rect,
+) -> bool {
+    if tree.is_null() || id.is_null() || bbox.is_null() {
+        return false;
+    }
+    let tree = unsafe { &*tree };
+    let id = match unsafe { std::ffi::CStr::from_ptr(id) }.to_str() {
+        Ok(id) if !id.is_empty() => id,
+        _ => return false,
+    };
+    let r = match tree.0.node_by_id(id).and_then(|node| node.abs_layer_bounding_box()) {
+        Some(r) => r,
+        None => return false,
+    };
+    unsafe {
+        *bbox = resvg_rect { x: r.x(), y: r.y(), width: r.width(), height: r.height() };
+    }
+    true
+}
+
+// =============================================================================
+// Node Bounds (added by swift-resvg)
+// =============================================================================
+
+/// Writes the bounding box of each node in a list, in canvas coordinates.
+///
+/// Uses the object bounding box, or the stroke bounding box if `stroke` is
+/// true. `boxes` must hold at least as many rects as the list has nodes.
+/// Returns false if an argument is NULL or `boxes` is too small.
+#[no_mangle]
+pub extern "C" fn resvg_node_list_bboxes(
+    list: *const resvg_node_list,
+    stroke: bool,
+    boxes: *mut resvg_rect,
+    boxes_len: usize,
+) -> bool {
+    if list.is_null() {
+        return false;
+    }
+    let list = unsafe { &*list };
+    if list.0.len() > boxes_len || (!list.0.is_empty() && boxes.is_null()) {
+        return false;
+    }
+    for (i, &node) in list.0.iter().enumerate() {
+        let node = unsafe { &*node };
+        let r = if stroke { node.abs_stroke_bounding_box() } else { node.abs_bounding_box() };
+        unsafe {
+            *boxes.add(i) = resvg_rect { x: r.x(), y: r.y(), width: r.width(), height: r.height() };
+        }
+    }
+    true
+}
+
+// =============================================================================
+// Path Flattening and Tessellation (added by swift-resvg)
+// =============================================================================
+
+/// Builds a lyon path from a tiny-skia path, mapping every point through `ts`.
+fn swift_resvg_lyon_path(
+    data: &resvg::tiny_skia::Path,
+    ts: resvg::tiny_skia::Transform,
+) -> lyon_tessellation::path::Path {
+    let map = |p: resvg::tiny_skia::Point| {
+        lyon_tessellation::math::point(
+            ts.sx * p.x + ts.kx * p.y + ts.tx,
+            ts.ky * p.x + ts.sy * p.y + ts.ty,
+        )
+    };
+
+    let mut builder = lyon_tessellation::path::Path::builder();
+    let mut open = false;
+    for segment in data.segments() {
+        match segment {
+            resvg::tiny_skia::PathSegment::MoveTo(p) => {
+                if open {
+                    builder.end(false);
+                }
+                builder.begin(map(p));
+                open = true;
+            }
+            resvg::tiny_skia::PathSegment::LineTo(p) => {
+                builder.line_to(map(p));
+            }
+            resvg::tiny_skia::PathSegment::QuadTo(p1, p) => {
+                builder.quadratic_bezier_to(map(p1), map(p));
+            }
+            resvg::tiny_skia::PathSegment::CubicTo(p1, p2, p) => {
+                builder.cubic_bezier_to(map(p1), map(p2), map(p));
+            }
+            resvg::tiny_skia::PathSegment::Close => {
+                if open {
+                    builder.end(true);
+                    open = false;
+                }
+            }
+        }
+    }
+    if open {
+        builder.end(false);
+    }
+    builder.build()
+}
+
+fn swift_resvg_path_transform(path: &usvg::Path, absolute: bool) -> resvg::tiny_skia::Transform {
+    if absolute {
+        path.abs_transform()
+    } else {
+        resvg::tiny_skia::Transform::identity()
+    }
+}
+
+/// Polylines approximating the subpaths of a path (owned).
+pub struct resvg_polylines {
+    points: Vec<f32>,
+    starts: Vec<u32>,
+    closed: Vec<u8>,
+}
+
+/// Flattens a path's curves into one polyline per subpath.
+///
+/// No point is further than `tolerance` from the curve it replaces. If
+/// `absolute` is true, points are mapped through the path's absolute
+/// transform. Returns NULL if the path is NULL or `tolerance` is not positive.
+/// Must be freed via `resvg_polylines_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_path_flatten(path: *const usvg::Path, tolerance: f32, absolute: bool) -> *mut resvg_polylines {
+    use lyon_tessellation::path::iterator::PathIterator;
+    use lyon_tessellation::path::PathEvent;
+
+    if path.is_null() || !(tolerance > 0.0) {
+        return std::ptr::null_mut();
+    }
+    let path = unsafe { &*path };
+    let lyon_path = swift_resvg_lyon_path(path.data(), swift_resvg_path_transform(path, absolute));
+
+    let mut out = resvg_polylines { points: Vec::new(), starts: Vec::new(), closed: Vec::new() };
+    for event in lyon_path.iter().flattened(tolerance) {
+        match event {
+            PathEvent::Begin { at } => {
+                out.starts.push((out.points.len() / 2) as u32);
+                out.closed.push(0);
+                out.points.extend_from_slice(&[at.x, at.y]);
+            }
+            PathEvent::Line { to, .. } => {
+                out.points.extend_from_slice(&[to.x, to.y]);
+            }
+            PathEvent::End { close, .. } => {
+                if close {
+                    if let Some(last) = out.closed.last_mut() {
+                        *last = 1;
+                    }
+                }
+            }
+            _ => {}
+        }
+    }
+    Box::into_raw(Box::new(out))
+}
+
+/// Returns the interleaved x/y points of all polylines and their float count in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_polylines_points(polylines: *const resvg_polylines, len: *mut usize) -> *const f32 {
+    if polylines.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let polylines = unsafe { &*polylines };
+    unsafe { *len = polylines.points.len(); }
+    polylines.points.as_ptr()
+}
+
+/// Returns the index of the first point of each polyline and the polyline count in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_polylines_starts(polylines: *const resvg_polylines, len: *mut usize) -> *const u32 {
+    if polylines.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let polylines = unsafe { &*polylines };
+    unsafe { *len = polylines.starts.len(); }
+    polylines.starts.as_ptr()
+}
+
+/// Returns 1 for each closed polyline and 0 for each open one, with the count in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_polylines_closed(polylines: *const resvg_polylines, len: *mut usize) -> *const u8 {
+    if polylines.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let polylines = unsafe { &*polylines };
+    unsafe { *len = polylines.closed.len(); }
+    polylines.closed.as_ptr()
+}
+
+/// Frees polylines created by `resvg_path_flatten`.
+#[no_mangle]
+pub extern "C" fn resvg_polylines_destroy(polylines: *mut resvg_polylines) {
+    if !polylines.is_null() {
+        unsafe { let _ = Box::from_raw(polylines); }
+    }
+}
+
+/// Indexed triangles covering the fill area of a path (owned).
+pub struct resvg_triangles {
+    vertices: Vec<f32>,
+    indices: Vec<u32>,
+}
+
+/// Tessellates the fill area of a path into indexed triangles.
+///
+/// Curves are flattened to within `tolerance` first, and `fill_rule` decides
+/// which regions are inside. If `absolute` is true, vertices are mapped
+/// through the path's absolute transform. Returns NULL if the path is NULL,
+/// `tolerance` is not positive or tessellation fails.
+/// Must be freed via `resvg_triangles_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_path_triangulate(
+    path: *const usvg::Path,
+    tolerance: f32,
+    fill_rule: resvg_fill_rule,
+    absolute: bool,
+) -> *mut resvg_triangles {
+    if path.is_null() || !(tolerance > 0.0) {
+        return std::ptr::null_mut();
+    }
+    let path = unsafe { &*path };
+    let lyon_path = swift_resvg_lyon_path(path.data(), swift_resvg_path_transform(path, absolute));
+
+    let rule = match fill_rule {
+        resvg_fill_rule::RESVG_FILL_EVENODD => lyon_tessellation::FillRule::EvenOdd,
+        resvg_fill_rule::RESVG_FILL_NONZERO => lyon_tessellation::FillRule::NonZero,
+    };
+    let options = lyon_tessellation::FillOptions::tolerance(tolerance).with_fill_rule(rule);
+    let mut buffers: lyon_tessellation::VertexBuffers<[f32; 2], u32> = lyon_tessellation::VertexBuffers::new();
+    let result = lyon_tessellation::FillTessellator::new().tessellate_path(
+        &lyon_path,
+        &options,
+        &mut lyon_tessellation::BuffersBuilder::new(&mut buffers, |vertex: lyon_tessellation::FillVertex| {
+            vertex.position().to_array()
+        }),
+    );
+    if result.is_err() {
+        return std::ptr::null_mut();
+    }
+
+    let vertices = buffers.vertices.iter().flat_map(|v| v.iter().copied()).collect();
+    Box::into_raw(Box::new(resvg_triangles { vertices, indices: buffers.indices }))
+}
+
+/// Returns the interleaved x/y vertices and their float count in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_triangles_vertices(triangles: *const resvg_triangles, len: *mut usize) -> *const f32 {
+    if triangles.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let triangles = unsafe { &*triangles };
+    unsafe { *len = triangles.vertices.len(); }
+    triangles.vertices.as_ptr()
+}
+
+/// Returns three vertex indices per triangle and the index count in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_triangles_indices(triangles: *const resvg_triangles, len: *mut usize) -> *const u32 {
+    if triangles.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let triangles = unsafe { &*triangles };
+    unsafe { *len = triangles.indices.len(); }
+    triangles.indices.as_ptr()
+}
+
+/// Frees triangles created by `resvg_path_triangulate`.
+#[no_mangle]
+pub extern "C" fn resvg_triangles_destroy(triangles: *mut resvg_triangles) {
+    if !triangles.is_null() {
+        unsafe { let _ = Box::from_raw(triangles); }
+    }
+}
+
+// =============================================================================
+// Stroke Outline (added by swift-resvg)
+// =============================================================================
+
+/// Path data in the verb/point layout of `resvg_path_data_copy` (owned).
+pub struct resvg_path_outline {
+    verbs: Vec<u8>,
+    points: Vec<f32>,
+}
+
+/// Converts a usvg stroke to the tiny-skia stroke resvg renders with.
+fn swift_resvg_tiny_skia_stroke(s: &usvg::Stroke) -> resvg::tiny_skia::Stroke {
+    resvg::tiny_skia::Stroke {
+        width: s.width().get(),
+        miter_limit: s.miterlimit().get(),
+        line_cap: match s.linecap() {
+            usvg::LineCap::Butt => resvg::tiny_skia::LineCap::Butt,
+            usvg::LineCap::Round => resvg::tiny_skia::LineCap::Round,
+            usvg::LineCap::Square => resvg::tiny_skia::LineCap::Square,
+        },
+        line_join: match s.linejoin() {
+            usvg::LineJoin::Miter => resvg::tiny_skia::LineJoin::Miter,
+            usvg::LineJoin::MiterClip => resvg::tiny_skia::LineJoin::MiterClip,
+            usvg::LineJoin::Round => resvg::tiny_skia::LineJoin::Round,
+            usvg::LineJoin::Bevel => resvg::tiny_skia::LineJoin::Bevel,
+        },
+        dash: s
+            .dasharray()
+            .and_then(|list| resvg::tiny_skia::StrokeDash::new(list.to_vec(), s.dashoffset())),
+    }
+}
+
+/// Returns the filled outline of a path's stroke, with dashes, caps and joins applied.
+///
+/// Uses tiny-skia's dasher and stroker, the same ones resvg renders with.
+/// `resolution_scale` is the scale the outline will be displayed at; larger
+/// values produce finer round joins and caps. Returns NULL if the path is
+/// NULL, `resolution_scale` is not positive and finite, the path has no
+/// stroke, or the stroke produces no geometry.
+/// Must be freed via `resvg_path_outline_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_path_stroke_outline(path: *const usvg::Path, resolution_scale: f32) -> *mut resvg_path_outline {
+    if path.is_null() || !(resolution_scale > 0.0) || !resolution_scale.is_finite() {
+        return std::ptr::null_mut();
+    }
+    let path = unsafe { &*path };
+    let stroke = match path.stroke() {
+        Some(stroke) => swift_resvg_tiny_skia_stroke(stroke),
+        None => return std::ptr::null_mut(),
+    };
+
+    // Stroking ignores `stroke.dash`, so dash first as tiny-skia's renderer does.
+    let dashed;
+    let source = match stroke.dash {
+        Some(ref dash) => match path.data().dash(dash, resolution_scale) {
+            Some(dashed_path) => {
+                dashed = dashed_path;
+                &dashed
+            }
+            None => return std::ptr::null_mut(),
+        },
+        None => path.data(),
+    };
+    let outline = match source.stroke(&stroke, resolution_scale) {
+        Some(outline) => outline,
+        None => return std::ptr::null_mut(),
+    };
+
+    let verbs_len = outline.verbs().len();
+    let points_len = outline.points().len() * 2;
+    let mut out = resvg_path_outline { verbs: vec![0; verbs_len], points: vec![0.0; points_len] };
+    if !swift_resvg_copy_path_data(&outline, out.verbs.as_mut_ptr(), verbs_len, out.points.as_mut_ptr(), points_len) {
+        return std::ptr::null_mut();
+    }
+    Box::into_raw(Box::new(out))
+}
+
+/// Returns the verbs of an outline and their count in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_path_outline_verbs(outline: *const resvg_path_outline, len: *mut usize) -> *const u8 {
+    if outline.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let outline = unsafe { &*outline };
+    unsafe { *len = outline.verbs.len(); }
+    outline.verbs.as_ptr()
+}
+
+/// Returns the interleaved x/y points of an outline and their float count in `len`.
+#[no_mangle]
+pub extern "C" fn resvg_path_outline_points(outline: *const resvg_path_outline, len: *mut usize) -> *const f32 {
+    if outline.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let outline = unsafe { &*outline };
+    unsafe { *len = outline.points.len(); }
+    outline.points.as_ptr()
+}
+
+/// Frees an outline created by `resvg_path_stroke_outline`.
+#[no_mangle]
+pub extern "C" fn resvg_path_outline_destroy(outline: *mut resvg_path_outline) {
+    if !outline.is_null() {
+        unsafe { let _ = Box::from_raw(outline); }
+    }
+}
+
+// =============================================================================
+// Image Loading (added by swift-resvg)
+// =============================================================================
+
+/// Image loading enumeration
+#[repr(C)]
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub enum resvg_image_loading {
+    RESVG_IMAGE_LOADING_EAGER = 0,
+    RESVG_IMAGE_LOADING_SKIP = 1,
+}
+
+/// Sets how `<image>` elements are resolved while parsing.
+///
+/// `RESVG_IMAGE_LOADING_SKIP` installs href resolvers that resolve nothing:
+/// linked files are not read, nested SVG documents are not parsed and embedded
+/// bytes are released, so image elements are left out of the tree.
+#[no_mangle]
+pub extern "C" fn resvg_options_set_image_loading(opt: *mut resvg_options, loading: resvg_image_loading) {
+    if opt.is_null() {
+        return;
+    }
+    cast_opt(opt).image_href_resolver = match loading {
+        resvg_image_loading::RESVG_IMAGE_LOADING_EAGER => usvg::ImageHrefResolver::default(),
+        resvg_image_loading::RESVG_IMAGE_LOADING_SKIP => usvg::ImageHrefResolver {
+            resolve_data: Box::new(|_, _, _| None),
+            resolve_string: Box::new(|_, _| None),
+        },
+    };
+}
+
+/// Returns the encoded bytes of a raster image; `len` receives the byte count.
+///
+/// Returns NULL for SVG images. The bytes are valid while the tree is alive.
+#[no_mangle]
+pub extern "C" fn resvg_image_encoded_data(image: *const usvg::Image, len: *mut usize) -> *const u8 {
+    if image.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let image = unsafe { &*image };
+    let data = match image.kind() {
+        usvg::ImageKind::JPEG(data)
+        | usvg::ImageKind::PNG(data)
+        | usvg::ImageKind::GIF(data)
+        | usvg::ImageKind::WEBP(data) => data,
+        usvg::ImageKind::SVG(_) => return std::ptr::null(),
+    };
+    unsafe { *len = data.len(); }
+    data.as_ptr()
+}
+
+/// Decoded straight RGBA pixels of an image.
+pub struct resvg_image_pixels {
+    width: u32,
+    height: u32,
+    data: Vec<u8>,
+}
+
+fn swift_resvg_rgb_to_rgba(pixels: &[u8]) -> Vec<u8> {
+    pixels.chunks_exact(3).flat_map(|p| [p[0], p[1], p[2], 255]).collect()
+}
+
+fn swift_resvg_gray_to_rgba(pixels: &[u8]) -> Vec<u8> {
+    pixels.iter().flat_map(|&g| [g, g, g, 255]).collect()
+}
+
+fn swift_resvg_decode_png(data: &[u8]) -> Option<resvg_image_pixels> {
+    let mut decoder = png::Decoder::new(data);
+    decoder.set_transformations(png::Transformations::normalize_to_color8());
+    let mut reader = decoder.read_info().ok()?;
+    let mut buffer = vec![0; reader.output_buffer_size()];
+    let info = reader.next_frame(&mut buffer).ok()?;
+    buffer.truncate(info.buffer_size());
+
+    let data = match info.color_type {
+        png::ColorType::Rgba => buffer,
+        png::ColorType::Rgb => swift_resvg_rgb_to_rgba(&buffer),
+        png::ColorType::GrayscaleAlpha => buffer.chunks_exact(2).flat_map(|p| [p[0], p[0], p[0], p[1]]).collect(),
+        png::ColorType::Grayscale => swift_resvg_gray_to_rgba(&buffer),
+        // Palettes are expanded by `normalize_to_color8`.
+        png::ColorType::Indexed => return None,
+    };
+    Some(resvg_image_pixels { width: info.width, height: info.height, data })
+}
+
+fn swift_resvg_decode_jpeg(data: &[u8]) -> Option<resvg_image_pixels> {
+    use zune_jpeg::zune_core::colorspace::ColorSpace;
+    use zune_jpeg::zune_core::options::DecoderOptions;
+
+    let options = DecoderOptions::default().jpeg_set_out_colorspace(ColorSpace::RGBA);
+    let mut decoder = zune_jpeg::JpegDecoder::new_with_options(data, options);
+    let pixels = decoder.decode().ok()?;
+    let info = decoder.info()?;
+
+    let data = match decoder.get_output_colorspace()? {
+        ColorSpace::RGBA => pixels,
+        ColorSpace::RGB => swift_resvg_rgb_to_rgba(&pixels),
+        ColorSpace::Luma => swift_resvg_gray_to_rgba(&pixels),
+        _ => return None,
+    };
+    Some(resvg_image_pixels { width: info.width as u32, height: info.height as u32, data })
+}
+
+fn swift_resvg_decode_gif(data: &[u8]) -> Option<resvg_image_pixels> {
+    let mut options = gif::DecodeOptions::new();
+    options.set_color_output(gif::ColorOutput::RGBA);
+    let mut decoder = options.read_info(data).ok()?;
+    // Like resvg, only the first frame is used.
+    let frame = decoder.read_next_frame().ok()??;
+    Some(resvg_image_pixels {
+        width: frame.width as u32,
+        height: frame.height as u32,
+        data: frame.buffer.to_vec(),
+    })
+}
+
+/// Decodes a JPEG, PNG or GIF image to straight RGBA pixels.
+///
+/// Decoding uses the same crates resvg renders with and happens on every
+/// call; nothing is cached in the tree.
+/// Returns NULL for SVG and WebP images or undecodable data.
+/// Must be freed via `resvg_image_pixels_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_image_decode(image: *const usvg::Image) -> *mut resvg_image_pixels {
+    if image.is_null() {
+        return std::ptr::null_mut();
+    }
+    let image = unsafe { &*image };
+    let decoded = match image.kind() {
+        usvg::ImageKind::PNG(data) => swift_resvg_decode_png(data),
+        usvg::ImageKind::JPEG(data) => swift_resvg_decode_jpeg(data),
+        usvg::ImageKind::GIF(data) => swift_resvg_decode_gif(data),
+        usvg::ImageKind::WEBP(_) | usvg::ImageKind::SVG(_) => None,
+    };
+    match decoded {
+        Some(pixels) => Box::into_raw(Box::new(pixels)),
+        None => std::ptr::null_mut(),
+    }
+}
+
+/// Returns the width of decoded pixels.
+#[no_mangle]
+pub extern "C" fn resvg_image_pixels_width(pixels: *const resvg_image_pixels) -> u32 {
+    if pixels.is_null() {
+        return 0;
+    }
+    unsafe { (*pixels).width }
+}
+
+/// Returns the height of decoded pixels.
+#[no_mangle]
+pub extern "C" fn resvg_image_pixels_height(pixels: *const resvg_image_pixels) -> u32 {
+    if pixels.is_null() {
+        return 0;
+    }
+    unsafe { (*pixels).height }
+}
+
+/// Returns the RGBA bytes of decoded pixels; `len` receives the byte count.
+#[no_mangle]
+pub extern "C" fn resvg_image_pixels_data(pixels: *const resvg_image_pixels, len: *mut usize) -> *const u8 {
+    if pixels.is_null() || len.is_null() {
+        return std::ptr::null();
+    }
+    let pixels = unsafe { &*pixels };
+    unsafe { *len = pixels.data.len(); }
+    pixels.data.as_ptr()
+}
+
+/// Frees pixels created by `resvg_image_decode`.
+#[no_mangle]
+pub extern "C" fn resvg_image_pixels_destroy(pixels: *mut resvg_image_pixels) {
+    if !pixels.is_null() {
+        unsafe { let _ = Box::from_raw(pixels); }
+    }
+}
+
+// =============================================================================
+// Paint Overrides (added by swift-resvg)
+// =============================================================================
+
+/// Paint override target enumeration
+#[repr(C)]
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub enum resvg_paint_target {
+    RESVG_PAINT_TARGET_COLOR = 0,
+    RESVG_PAINT_TARGET_PAINT_SERVER = 1,
+    RESVG_PAINT_TARGET_ELEMENT = 2,
+}
+
+/// One paint substitution rule.
+///
+/// `id_offset` and `id_len` locate the target ID in the shared `ids` buffer
+/// for paint server and element targets.
+#[repr(C)]
+#[derive(Copy, Clone, Debug)]
+pub struct resvg_paint_override {
+    pub target: resvg_paint_target,
+    pub color: resvg_color,
+    pub id_offset: u32,
+    pub id_len: u32,
+    pub replaces_color: bool,
+    pub new_color: resvg_color,
+    pub opacity: f32,
+}
+
+/// Maps paint server IDs in a parsed tree to the IDs they have in the source.
+///
+/// usvg turns gradients and patterns with objectBoundingBox units into
+/// per-shape user-space copies with generated IDs; this records which source
+/// element each copy came from.
+pub struct resvg_paint_origins(std::collections::HashMap<String, String>);
+
+/// Gives every gradient and pattern with an ID user-space units, so usvg keeps
+/// their IDs when parsing.
+fn swift_resvg_mark_paint_servers(svg: &str) -> Option<String> {
+    let document = roxmltree::Document::parse(svg).ok()?;
+    let mut edits: Vec<(std::ops::Range<usize>, String)> = Vec::new();
+    for node in document.descendants().filter(|node| node.is_element()) {
+        let units: &[&str] = match node.tag_name().name() {
+            "linearGradient" | "radialGradient" => &["gradientUnits"],
+            "pattern" => &["patternUnits", "patternContentUnits"],
+            _ => continue,
+        };
+        let id = match node.attribute_node("id") {
+            Some(id) => id,
+            None => continue,
+        };
+        for name in units {
+            match node.attribute_node(*name) {
+                Some(existing) => edits.push((existing.range_value(), "userSpaceOnUse".to_string())),
+                None => {
+                    let end = id.range().end;
+                    edits.push((end..end, format!(" {}=\"userSpaceOnUse\"", name)));
+                }
+            }
+        }
+    }
+    edits.sort_by_key(|(range, _)| (range.start, range.end));
+
+    let mut out = String::with_capacity(svg.len() + edits.len() * 32);
+    let mut position = 0;
+    for (range, text) in edits {
+        out.push_str(&svg[position..range.start]);
+        out.push_str(&text);
+        position = range.end;
+    }
+    out.push_str(&svg[position..]);
+    Some(out)
+}
+
+fn swift_resvg_paint_id(paint: &usvg::Paint) -> Option<&str> {
+    match paint {
+        usvg::Paint::Color(_) => None,
+        usvg::Paint::LinearGradient(lg) => Some(lg.id()),
+        usvg::Paint::RadialGradient(rg) => Some(rg.id()),
+        usvg::Paint::Pattern(pattern) => Some(pattern.id()),
+    }
+}
+
+/// Paths drawn into the canvas (not mask, clip or pattern contents), in order.
+fn swift_resvg_collect_paths<'a>(group: &'a usvg::Group, out: &mut Vec<&'a usvg::Path>) {
+    for node in group.children() {
+        match node {
+            usvg::Node::Group(group) => swift_resvg_collect_paths(group, out),
+            usvg::Node::Path(path) => out.push(path),
+            usvg::Node::Text(text) => swift_resvg_collect_paths(text.flattened(), out),
+            usvg::Node::Image(_) => {}
+        }
+    }
+}
+
+/// Records which source paint server each paint server of `tree` came from.
+///
+/// `data` must be the source `tree` was parsed from, and `opt` the options it
+/// was parsed with. The source is parsed again with every gradient and
+/// pattern in user-space units, which keeps their IDs, and the paths of both
+/// trees are matched by geometry. Returns NULL on error.
+/// Must be freed via `resvg_paint_origins_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_paint_origins_create(
+    tree: *const resvg_render_tree,
+    data: *const std::os::raw::c_char,
+    len: usize,
+    opt: *const resvg_options,
+) -> *mut resvg_paint_origins {
+    if tree.is_null() || data.is_null() || opt.is_null() {
+        return std::ptr::null_mut();
+    }
+    let tree = unsafe { &*tree };
+    let data = unsafe { std::slice::from_raw_parts(data as *const u8, len) };
+    let decompressed;
+    let data = if data.starts_with(&[0x1f, 0x8b]) {
+        decompressed = match usvg::decompress_svgz(data) {
+            Ok(decompressed) => decompressed,
+            Err(_) => return std::ptr::null_mut(),
+        };
+        &decompressed[..]
+    } else {
+        data
+    };
+    let marked = match std::str::from_utf8(data).ok().and_then(swift_resvg_mark_paint_servers) {
+        Some(marked) => marked,
+        None => return std::ptr::null_mut(),
+    };
+    let mut marked_tree: *mut resvg_render_tree = std::ptr::null_mut();
+    let status = resvg_parse_tree_from_data(
+        marked.as_ptr() as *const std::os::raw::c_char,
+        marked.len(),
+        opt,
+        &mut marked_tree,
+    );
+    if status != 0 || marked_tree.is_null() {
+        return std::ptr::null_mut();
+    }
+    let marked_tree = unsafe { Box::from_raw(marked_tree) };
+
+    let mut paths = Vec::new();
+    swift_resvg_collect_paths(tree.0.root(), &mut paths);
+    let mut marked_paths = Vec::new();
+    swift_resvg_collect_paths(marked_tree.0.root(), &mut marked_paths);
+
+    // Units can decide whether a path is kept (bounding-box paints on
+    // zero-sized shapes are dropped), so skip marked paths until one has the
+    // same geometry.
+    let mut origins = std::collections::HashMap::new();
+    let mut marked_paths = marked_paths.into_iter();
+    for path in paths {
+        let same = |other: &&usvg::Path| {
+            other.data().verbs() == path.data().verbs() && other.data().points() == path.data().points()
+        };
+        let marked_path = match marked_paths.find(same) {
+            Some(marked_path) => marked_path,
+            None => break,
+        };
+        let pairs = [
+            (path.fill().map(|f| f.paint()), marked_path.fill().map(|f| f.paint())),
+            (path.stroke().map(|s| s.paint()), marked_path.stroke().map(|s| s.paint())),
+        ];
+        for pair in pairs {
+            if let (Some(paint), Some(marked_paint)) = pair {
+                if let (Some(id), Some(source_id)) = (swift_resvg_paint_id(paint), swift_resvg_paint_id(marked_paint)) {
+                    if id != source_id {
+                        origins.insert(id.to_string(), source_id.to_string());
+                    }
+                }
+            }
+        }
+    }
+    Box::into_raw(Box::new(resvg_paint_origins(origins)))
+}
+
+/// Frees paint origins created by `resvg_paint_origins_create`.
+#[no_mangle]
+pub extern "C" fn resvg_paint_origins_destroy(origins: *mut resvg_paint_origins) {
+    if !origins.is_null() {
+        unsafe { drop(Box::from_raw(origins)) };
+    }
+}
+
+/// Override rules with their IDs decoded, applied to one cloned tree.
+struct SwiftResvgRecolor<'a> {
+    rules: Vec<(&'a resvg_paint_override, &'a str)>,
+    origins: Option<&'a std::collections::HashMap<String, String>>,
+    /// Gradients whose stops were recolored, and their replacements (None if unchanged).
+    gradients: Vec<(usvg::Paint, Option<usvg::Paint>)>,
+}
+
+impl<'a> SwiftResvgRecolor<'a> {
+    fn source_id<'b>(&'b self, id: &'b str) -> &'b str {
+        self.origins.and_then(|origins| origins.get(id)).map(|id| id.as_str()).unwrap_or(id)
+    }
+
+    /// The last rule matching a paint of a node with the given own and ancestor IDs.
+    fn rule(&self, paint: &usvg::Paint, ids: &[String]) -> Option<&'a resvg_paint_override> {
+        self.rules
+            .iter()
+            .rev()
+            .find(|(rule, id)| match rule.target {
+                resvg_paint_target::RESVG_PAINT_TARGET_COLOR => match paint {
+                    usvg::Paint::Color(c) => [c.red, c.green, c.blue] == [rule.color.r, rule.color.g, rule.color.b],
+                    _ => false,
+                },
+                resvg_paint_target::RESVG_PAINT_TARGET_PAINT_SERVER => {
+                    swift_resvg_paint_id(paint).map(|paint_id| self.source_id(paint_id)) == Some(*id)
+                }
+                resvg_paint_target::RESVG_PAINT_TARGET_ELEMENT => ids.iter().any(|ancestor| ancestor == id),
+            })
+            .map(|(rule, _)| *rule)
+    }
+
+    /// Copy of a gradient with color rules applied to its stops, or None if no stop matches.
+    fn recolor_stops(&mut self, paint: &usvg::Paint) -> Option<usvg::Paint> {
+        let same = |other: &usvg::Paint| match (paint, other) {
+            (usvg::Paint::LinearGradient(a), usvg::Paint::LinearGradient(b)) => std::sync::Arc::ptr_eq(a, b),
+            (usvg::Paint::RadialGradient(a), usvg::Paint::RadialGradient(b)) => std::sync::Arc::ptr_eq(a, b),
+            _ => false,
+        };
+        if let Some((_, cached)) = self.gradients.iter().find(|(old, _)| same(old)) {
+            return cached.clone();
+        }
+
+        let stops = match paint {
+            usvg::Paint::LinearGradient(lg) => lg.stops(),
+            usvg::Paint::RadialGradient(rg) => rg.stops(),
+            _ => return None,
+        };
+        let mut changed = false;
+        let stops: Vec<usvg::Stop> = stops
+            .iter()
+            .map(|stop| {
+                let c = stop.color();
+                let rule = self.rules.iter().rev().find(|(rule, _)| {
+                    rule.target == resvg_paint_target::RESVG_PAINT_TARGET_COLOR
+                        && [c.red, c.green, c.blue] == [rule.color.r, rule.color.g, rule.color.b]
+                });
+                match rule {
+                    Some((rule, _)) => {
+                        changed = true;
+                        let color = if rule.replaces_color {
+                            usvg::Color::new_rgb(rule.new_color.r, rule.new_color.g, rule.new_color.b)
+                        } else {
+                            c
+                        };
+                        let opacity = if rule.opacity >= 0.0 {
+                            usvg::Opacity::new_clamped(rule.opacity)
+                        } else {
+                            stop.opacity()
+                        };
+                        stop.swift_resvg_with_color(color, opacity)
+                    }
+                    None => *stop,
+                }
+            })
+            .collect();
+
+        let recolored = if !changed {
+            None
+        } else {
+            match paint {
+                usvg::Paint::LinearGradient(lg) => {
+                    Some(usvg::Paint::LinearGradient(std::sync::Arc::new(lg.swift_resvg_with_stops(stops))))
+                }
+                usvg::Paint::RadialGradient(rg) => {
+                    Some(usvg::Paint::RadialGradient(std::sync::Arc::new(rg.swift_resvg_with_stops(stops))))
+                }
+                _ => None,
+            }
+        };
+        self.gradients.push((paint.clone(), recolored.clone()));
+        recolored
+    }
+
+    /// The replacement paint and opacity, or None to keep the current ones.
+    fn recolor(&mut self, paint: &usvg::Paint, opacity: usvg::Opacity, ids: &[String]) -> Option<(usvg::Paint, usvg::Opacity)> {
+        let mut new_paint = None;
+        let mut new_opacity = None;
+        if let Some(rule) = self.rule(paint, ids) {
+            if rule.replaces_color {
+                let c = rule.new_color;
+                new_paint = Some(usvg::Paint::Color(usvg::Color::new_rgb(c.r, c.g, c.b)));
+            }
+            if rule.opacity >= 0.0 {
+                new_opacity = Some(usvg::Opacity::new_clamped(rule.opacity));
+            }
+        }
+        if new_paint.is_none() {
+            new_paint = self.recolor_stops(paint);
+        }
+        if new_paint.is_none() && new_opacity.is_none() {
+            return None;
+        }
+        Some((new_paint.unwrap_or_else(|| paint.clone()), new_opacity.unwrap_or(opacity)))
+    }
+
+    /// Recolors the paths below `group`; `ids` holds the IDs of its ancestors.
+    fn apply(&mut self, group: &mut usvg::Group, ids: &mut Vec<String>) {
+        let named = !group.id().is_empty();
+        if named {
+            ids.push(group.id().to_string());
+        }
+        for node in group.swift_resvg_children_mut().iter_mut() {
+            match node {
+                usvg::Node::Group(group) => self.apply(group, ids),
+                usvg::Node::Path(path) => {
+                    ids.push(path.id().to_string());
+                    let (fill, stroke) = path.swift_resvg_paints_mut();
+                    if let Some(fill) = fill {
+                        if let Some((paint, opacity)) = self.recolor(fill.paint(), fill.opacity(), ids) {
+                            fill.swift_resvg_set_paint(paint, opacity);
+                        }
+                    }
+                    if let Some(stroke) = stroke {
+                        if let Some((paint, opacity)) = self.recolor(stroke.paint(), stroke.opacity(), ids) {
+                            stroke.swift_resvg_set_paint(paint, opacity);
+                        }
+                    }
+                    ids.pop();
+                }
+                usvg::Node::Text(text) => {
+                    ids.push(text.id().to_string());
+                    self.apply(text.swift_resvg_flattened_mut(), ids);
+                    ids.pop();
+                }
+                usvg::Node::Image(_) => {}
+            }
+        }
+        if named {
+            ids.pop();
+        }
+    }
+}
+
+/// Returns a copy of the tree with paints replaced according to `overrides`.
+///
+/// The tree is cloned and its fills, strokes and gradient stops are edited in
+/// place, so no SVG is parsed or written. Paint server rules match the IDs in
+/// the source document when `origins` is given (see
+/// `resvg_paint_origins_create`), otherwise the IDs in the tree. Mask, clip
+/// path and pattern contents are left alone. When several rules match a
+/// paint, the last one wins.
+///
+/// Returns NULL on error. Must be freed via `resvg_tree_destroy`.
+#[no_mangle]
+pub extern "C" fn resvg_tree_recolor(
+    tree: *const resvg_render_tree,
+    origins: *const resvg_paint_origins,
+    overrides: *const resvg_paint_override,
+    count: usize,
+    ids: *const std::os::raw::c_char,
+    ids_len: usize,
+) -> *mut resvg_render_tree {
+    if tree.is_null() || (overrides.is_null() && count > 0) || (ids.is_null() && ids_len > 0) {
+        return std::ptr::null_mut();
+    }
+    let tree = unsafe { &*tree };
+    let origins = if origins.is_null() { None } else { Some(unsafe { &(*origins).0 }) };
+    let rules = if count == 0 { &[][..] } else { unsafe { std::slice::from_raw_parts(overrides, count) } };
+    let ids = if ids_len == 0 { &[][..] } else { unsafe { std::slice::from_raw_parts(ids as *const u8, ids_len) } };
+    let mut decoded = Vec::with_capacity(rules.len());
+    for rule in rules {
+        let range = rule.id_offset as usize..rule.id_offset as usize + rule.id_len as usize;
+        match ids.get(range).map(std::str::from_utf8) {
+            Some(Ok(id)) => decoded.push((rule, id)),
+            _ => return std::ptr::null_mut(),
+        }
+    }
+
+    let mut recolored = tree.0.clone();
+    let mut state = SwiftResvgRecolor { rules: decoded, origins, gradients: Vec::new() };
+    state.apply(recolored.swift_resvg_root_mut(), &mut Vec::new());
+
+    // Keep the writer's paint server list in step with the recolored gradients.
+    let replaced: Vec<(usvg::Paint, usvg::Paint)> = state
+        .gradients
+        .into_iter()
+        .filter_map(|(old, new)| new.map(|new| (old, new)))
+        .collect();
+    recolored.swift_resvg_replace_paint_servers(&replaced);
+
+    Box::into_raw(Box::new(resvg_render_tree(recolored)))
+}
+
+// =============================================================================
+// Render Cost Estimate (added by swift-resvg)
+// =============================================================================
+
+/// Work a render is expected to do, gathered in one traversal.
+///
+/// Areas are in output pixels at the requested scale.
+#[repr(C)]
+#[derive(Copy, Clone, Debug, Default)]
+pub struct resvg_render_cost {
+    pub groups: u32,
+    pub paths: u32,
+    pub images: u32,
+    pub texts: u32,
+    pub path_segments: u64,
+    pub gradients: u32,
+    pub patterns: u32,
+    pub masks: u32,
+    pub clip_paths: u32,
+    pub filters: u32,
+    pub layers: u32,
+    pub output_pixels: f64,
+    pub painted_pixels: f64,
+    pub gradient_pixels: f64,
+    pub layer_pixels: f64,
+    pub filter_pixels: f64,
+    pub image_pixels: u64,
+}
+
+fn swift_resvg_add_paint_cost(paint: &usvg::Paint, area: f64, area_scale: f64, cost: &mut resvg_render_cost) {
+    cost.painted_pixels += area;
+    match paint {
+        usvg::Paint::Color(_) => {}
+        usvg::Paint::LinearGradient(_) | usvg::Paint::RadialGradient(_) => {
+            cost.gradients += 1;
+            cost.gradient_pixels += area;
+        }
+        usvg::Paint::Pattern(pattern) => {
+            cost.patterns += 1;
+            cost.gradient_pixels += area;
+            swift_resvg_add_group_cost(pattern.root(), area_scale, cost);
+        }
+    }
+}
+
+fn swift_resvg_add_clip_path_cost(clip_path: &usvg::ClipPath, area_scale: f64, cost: &mut resvg_render_cost) {
+    cost.clip_paths += 1;
+    swift_resvg_add_group_cost(clip_path.root(), area_scale, cost);
+    if let Some(clip_path) = clip_path.clip_path() {
+        swift_resvg_add_clip_path_cost(clip_path, area_scale, cost);
+    }
+}
+
+fn swift_resvg_add_mask_cost(mask: &usvg::Mask, area_scale: f64, cost: &mut resvg_render_cost) {
+    cost.masks += 1;
+    swift_resvg_add_group_cost(mask.root(), area_scale, cost);
+    if let Some(mask) = mask.mask() {
+        swift_resvg_add_mask_cost(mask, area_scale, cost);
+    }
+}
+
+/// Adds the cost of a group's descendants, including the content of clip
+/// paths, masks, patterns, text and nested SVG images.
+fn swift_resvg_add_group_cost(group: &usvg::Group, area_scale: f64, cost: &mut resvg_render_cost) {
+    let area = |r: resvg::tiny_skia::Rect| (r.width() as f64) * (r.height() as f64) * area_scale;
+    for child in group.children() {
+        match child {
+            usvg::Node::Group(g) => {
+                cost.groups += 1;
+                if g.should_isolate() {
+                    let layer_area = child
+                        .abs_layer_bounding_box()
+                        .map_or(0.0, |r| (r.width() as f64) * (r.height() as f64) * area_scale);
+                    cost.layers += 1;
+                    cost.layer_pixels += layer_area;
+                    if !g.filters().is_empty() {
+                        cost.filters += g.filters().len() as u32;
+                        cost.filter_pixels += layer_area * g.filters().len() as f64;
+                    }
+                }
+                if let Some(clip_path) = g.clip_path() {
+                    swift_resvg_add_clip_path_cost(clip_path, area_scale, cost);
+                }
+                if let Some(mask) = g.mask() {
+                    swift_resvg_add_mask_cost(mask, area_scale, cost);
+                }
+                swift_resvg_add_group_cost(g, area_scale, cost);
+            }
+            usvg::Node::Path(p) => {
+                cost.paths += 1;
+                cost.path_segments += p.data().verbs().len() as u64;
+                if let Some(fill) = p.fill() {
+                    swift_resvg_add_paint_cost(fill.paint(), area(child.abs_bounding_box()), area_scale, cost);
+                }
+                if let Some(stroke) = p.stroke() {
+                    swift_resvg_add_paint_cost(stroke.paint(), area(child.abs_stroke_bounding_box()), area_scale, cost);
+                }
+            }
+            usvg::Node::Image(image) => {
+                cost.images += 1;
+                match image.kind() {
+                    usvg::ImageKind::SVG(tree) => swift_resvg_add_group_cost(tree.root(), area_scale, cost),
+                    usvg::ImageKind::JPEG(data)
+                    | usvg::ImageKind::PNG(data)
+                    | usvg::ImageKind::GIF(data)
+                    | usvg::ImageKind::WEBP(data) => {
+                        // Reads only the header; the image is not decoded.
+                        if let Ok(size) = imagesize::blob_size(data) {
+                            cost.image_pixels += size.width as u64 * size.height as u64;
+                        }
+                    }
+                }
+            }
+            usvg::Node::Text(text) => {
+                cost.texts += 1;
+                swift_resvg_add_group_cost(text.flattened(), area_scale, cost);
+            }
+        }
+    }
+}
+
+/// Estimates the work of rendering a tree at `scale` in one traversal.
+///
+/// Nothing is rendered or decoded. Returns false if `tree` or `cost` is NULL
+/// or `scale` is not positive.
+#[no_mangle]
+pub extern "C" fn resvg_tree_render_cost(
+    tree: *const resvg_render_tree,
+    scale: f32,
+    cost: *mut resvg_render_cost,
+) -> bool {
+    if tree.is_null() || cost.is_null() || !(scale > 0.0) {
+        return false;
+    }
+    let tree = unsafe { &*tree };
+    let area_scale = (scale as f64) * (scale as f64);
+
+    let mut out = resvg_render_cost::default();
+    let size = tree.0.size();
+    out.output_pixels = (size.width() as f64 * scale as f64).ceil() * (size.height() as f64 * scale as f64).ceil();
+    swift_resvg_add_group_cost(tree.0.root(), area_scale, &mut out);
+
+    unsafe { *cost = out; }
+    true
+}
+
+// =============================================================================
+// Interruptible Rendering (added by swift-resvg)
+// =============================================================================
+
+/// Asked before each node is drawn. Returns false to stop rendering.
+pub type resvg_render_callback = Option<extern "C" fn(context: *mut std::ffi::c_void) -> bool>;
+
+/// Walks the groups resvg draws straight into the canvas, asking `callback`
+/// before each node. Isolated groups go through a layer and are drawn whole.
+fn swift_resvg_render_nodes(
+    parent: &usvg::Group,
+    ctx: &resvg::render::Context,
+    transform: resvg::tiny_skia::Transform,
+    pixmap: &mut resvg::tiny_skia::PixmapMut,
+    callback: extern "C" fn(context: *mut std::ffi::c_void) -> bool,
+    context: *mut std::ffi::c_void,
+) -> bool {
+    for node in parent.children() {
+        if let usvg::Node::Group(ref group) = node {
+            if !group.should_isolate() {
+                // Same transform resvg's render_group uses for this case.
+                let transform = transform.pre_concat(group.transform());
+                if !swift_resvg_render_nodes(group, ctx, transform, pixmap, callback, context) {
+                    return false;
+                }
+                continue;
+            }
+        }
+        if !callback(context) {
+            return false;
+        }
+        resvg::render::render_node(node, ctx, transform, pixmap);
+    }
+    true
+}
+
+/// Renders like `resvg_render`, asking `callback` before each node is drawn.
+///
+/// Nodes are drawn by resvg's own renderer in the same order and with the
+/// same transforms, so the output matches `resvg_render` exactly. Returns
+/// false if an argument is NULL, the size is zero or the callback returned
+/// false; the pixmap then holds whatever was drawn before it stopped.
+#[no_mangle]
+pub extern "C" fn resvg_render_interruptible(
+    tree: *const resvg_render_tree,
+    transform: resvg_transform,
+    width: u32,
+    height: u32,
+    pixmap: *mut std::os::raw::c_char,
+    callback: resvg_render_callback,
+    context: *mut std::ffi::c_void,
+) -> bool {
+    if tree.is_null() || pixmap.is_null() {
+        return false;
+    }
+    let callback = match callback {
+        Some(callback) => callback,
+        None => return false,
+    };
+    let tree = unsafe { &*tree };
+    let len = width as usize * height as usize * 4;
+    let data = unsafe { std::slice::from_raw_parts_mut(pixmap as *mut u8, len) };
+    let mut pixmap = match resvg::tiny_skia::PixmapMut::from_bytes(data, width, height) {
+        Some(pixmap) => pixmap,
+        None => return false,
+    };
+
+    // The same culling bounds resvg::render uses.
+    let max_bbox = match resvg::tiny_skia::IntRect::from_xywh(
+        -(width as i32) * 2,
+        -(height as i32) * 2,
+        width * 5,
+        height * 5,
+    ) {
+        Some(rect) => rect,
+        None => return false,
+    };
+    let ctx = resvg::render::Context { max_bbox };
+    let t = resvg::tiny_skia::Transform::from_row(
+        transform.a, transform.b, transform.c, transform.d, transform.e, transform.f,
+    );
+    swift_resvg_render_nodes(tree.0.root(), &ctx, t, &mut pixmap, callback, context)
+}
+
+// =============================================================================
+// Node Rendering In Place (added by swift-resvg)
+// =============================================================================
+
+/// Renders a node by ID with the transforms of its ancestors applied.
+///
+/// resvg_render_node draws the node in its own coordinate space but sizes
+/// and offsets it by its canvas-space layer box, so nodes under transformed
+/// groups come out shifted or cropped. This draws the node where it is on the
+/// canvas, moved so its layer box (see `resvg_get_node_layer_bbox`) starts at
+/// the pixmap origin, then applies `transform`. Returns false if an argument
+/// is NULL, the ID is empty, not UTF-8 or unknown, the node renders nothing
+/// or the size is zero.
+#[no_mangle]
+pub extern "C" fn resvg_render_node_in_place(
+    tree: *const resvg_render_tree,
+    id: *const std::os::raw::c_char,
+    transform: resvg_transform,
+    width: u32,
+    height: u32,
+    pixmap: *mut std::os::raw::c_char,
+) -> bool {
+    if tree.is_null() || id.is_null() || pixmap.is_null() {
+        return false;
+    }
+    let tree = unsafe { &*tree };
+    let id = match unsafe { std::ffi::CStr::from_ptr(id) }.to_str() {
+        Ok(id) if !id.is_empty() => id,
+        _ => return false,
+    };
+    let node = match tree.0.node_by_id(id) {
+        Some(node) => node,
+        None => return false,
+    };
+    let bbox = match node.abs_layer_bounding_box() {
+        Some(bbox) => bbox,
+        None => return false,
+    };
+    // render_node applies a group's own transform, so pass its parent's.
+    let parent_transform = match node {
+        usvg::Node::Group(ref group) => match group.transform().invert() {
+            Some(own) => group.abs_transform().pre_concat(own),
+            None => return false,
+        },
+        _ => node.abs_transform(),
+    };
+
+    let len = width as usize * height as usize * 4;
+    let data = unsafe { std::slice::from_raw_parts_mut(pixmap as *mut u8, len) };
+    let mut pixmap = match resvg::tiny_skia::PixmapMut::from_bytes(data, width, height) {
+        Some(pixmap) => pixmap,
+        None => return false,
+    };
+
+    // The same culling bounds resvg::render uses.
+    let max_bbox = match resvg::tiny_skia::IntRect::from_xywh(
+        -(width as i32) * 2,
+        -(height as i32) * 2,
+        width * 5,
+        height * 5,
+    ) {
+        Some(rect) => rect,
+        None => return false,
+    };
+    let ctx = resvg::render::Context { max_bbox };
+    let t = resvg::tiny_skia::Transform::from_row(
+        transform.a, transform.b, transform.c, transform.d, transform.e, transform.f,
+    )
+    .pre_translate(-bbox.x(), -bbox.y())
+    .pre_concat(parent_transform);
+    resvg::render::render_node(node, &ctx, t, &mut pixmap);
+    true
+}
+'@
+
+$LibRsPath = Join-Path $BuildDir "resvg\crates\c-api\lib.rs"
+Add-Content -Path $LibRsPath -Value $RustPatch -Encoding UTF8
+
+Write-Host "Rust patch applied successfully"
+
+# The encoded-output API uses the png crate directly for compression control.
+# Pin the major version tiny-skia already depends on so only one copy is built.
+# Path flattening and tessellation use lyon.
+# Image decoding uses the JPEG and GIF decoders resvg already depends on.
+# Paint origins mark source paint servers with the XML parser usvg uses.
+# Cost estimates read image dimensions with usvg's header parser.
+$CargoTomlPath = Join-Path $BuildDir "resvg\crates\c-api\Cargo.toml"
+(Get-Content $CargoTomlPath) -replace '^\[dependencies\]$', "[dependencies]`npng = `"0.17`"`nlyon_tessellation = `"1`"`nzune-jpeg = `"0.4`"`ngif = `"0.13`"`nroxmltree = `"0.20`"`nimagesize = `"0.13`"" |
+    Set-Content $CargoTomlPath -Encoding UTF8
 
 #######################################
 # Build Windows targets
@@ -0,0 +1,221 @@
+import Foundation
+
+// MARK: - BatchRasterizer
+
+/// Rasterizes many SVG documents in parallel with bounded memory.
+///
+/// Inputs are pulled from a sequence only while fewer than `maxConcurrency`
+/// results are in flight or waiting to be delivered, so a slow consumer or a
+/// huge input directory never builds up unbounded pixel data. A failing item
+/// is reported through its `Item.result` and does not stop the batch.
+///
+/// Example usage:
+/// ```swift
+/// let batch = BatchRasterizer(rasterizer: SvgRasterizer(context: context), scale: 2)
+/// try await batch.rasterize(urls.map { .file($0) }) { item in
+///     switch item.result {
+///     case let .success(image): try write(image, for: item.input)
+///     case let .failure(error): print("\(item.index): \(error)")
+///     }
+/// }
+/// ```
+public struct BatchRasterizer: Sendable {
+    /// A document to rasterize.
+    public enum Input: Sendable {
+        case file(URL)
+        case data(Data)
+        case tree(SvgTree)
+    }
+
+    /// Order in which results are delivered.
+    public enum ResultOrder: Sendable {
+        /// As soon as each item finishes (lowest latency).
+        case completion
+
+        /// In the order inputs were produced. Finished items wait for earlier
+        /// ones and count against `maxConcurrency` while they wait.
+        case input
+    }
+
+    /// A finished item.
+    public struct Item: Sendable {
+        /// Position of the input in the input sequence.
+        public let index: Int
+
+        /// The input that was rasterized.
+        public let input: Input
+
+        /// The rendered image, or the error for this input.
+        public let result: Result<RasterizedSvg, ResvgError>
+    }
+
+    /// The rasterizer (and its context) used for every item.
+    public let rasterizer: SvgRasterizer
+
+    /// Maximum number of items rendering or awaiting delivery at once.
+    public let maxConcurrency: Int
+
+    /// Scale factor applied to every item.
+    public let scale: Double
+
+    /// Output pixel layout for every item.
+    public let pixelFormat: PixelFormat
+
+    /// Creates a batch rasterizer.
+    ///
+    /// - Parameters:
+    ///   - rasterizer: Rasterizer providing the shared context (default: default context)
+    ///   - maxConcurrency: Worker count and memory bound (default: active processor count)
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    public init(
+        rasterizer: SvgRasterizer = SvgRasterizer(),
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA
+    ) {
+        self.rasterizer = rasterizer
+        self.maxConcurrency = max(1, maxConcurrency)
+        self.scale = scale
+        self.pixelFormat = pixelFormat
+    }
+
+    /// Rasterizes every input of an async sequence
+    ///
+    /// `handler` is called once per input, never concurrently. New inputs are
+    /// not started while it runs, which throttles rendering to the consumer.
+    /// - Parameters:
+    ///   - inputs: Documents to rasterize
+    ///   - order: Delivery order of results (default: completion order)
+    ///   - handler: Receives each finished item
+    /// - Throws: Errors thrown by `inputs` or `handler`; remaining work is cancelled
+    public func rasterize<S: AsyncSequence>(
+        _ inputs: S,
+        order: ResultOrder = .completion,
+        _ handler: (Item) async throws -> Void
+    ) async throws where S.Element == Input {
+        var iterator = inputs.makeAsyncIterator()
+        try await rasterize(next: { try await iterator.next() }, order: order, handler)
+    }
+
+    /// Rasterizes every input of a sequence
+    ///
+    /// Inputs are pulled one at a time as slots free up, exactly like the
+    /// async sequence variant `rasterize(_:order:_:)`, so a lazy sequence is
+    /// never read ahead of the work.
+    /// - Parameters:
+    ///   - inputs: Documents to rasterize
+    ///   - order: Delivery order of results (default: completion order)
+    ///   - handler: Receives each finished item
+    /// - Throws: Errors thrown by `handler`; remaining work is cancelled
+    public func rasterize<S: Sequence>(
+        _ inputs: S,
+        order: ResultOrder = .completion,
+        _ handler: (Item) async throws -> Void
+    ) async throws where S.Element == Input {
+        var iterator = inputs.makeIterator()
+        try await rasterize(next: { iterator.next() }, order: order, handler)
+    }
+
+    /// Pulls the next input only when a slot is free, then tops up as each
+    /// finished item is delivered.
+    private func rasterize(
+        next: () async throws -> Input?,
+        order: ResultOrder,
+        _ handler: (Item) async throws -> Void
+    ) async throws {
+        let rasterizer = rasterizer
+        let scale = scale
+        let pixelFormat = pixelFormat
+
+        try await withThrowingTaskGroup(of: Item.self) { group in
+            var delivery = Delivery(order: order)
+            var inFlight = 0
+            var index = 0
+
+            while true {
+                while inFlight + delivery.waiting >= maxConcurrency, let item = try await group.next() {
+                    inFlight -= 1
+                    for ready in delivery.accept(item) {
+                        try await handler(ready)
+                    }
+                }
+                guard let input = try await next() else { break }
+
+                let itemIndex = index
+                group.addTask {
+                    Item(
+                        index: itemIndex,
+                        input: input,
+                        result: Self.render(input, with: rasterizer, scale: scale, pixelFormat: pixelFormat)
+                    )
+                }
+                inFlight += 1
+                index += 1
+            }
+
+            while let item = try await group.next() {
+                for ready in delivery.accept(item) {
+                    try await handler(ready)
+                }
+            }
+        }
+    }
+
+    static func render(
+        _ input: Input,
+        with rasterizer: SvgRasterizer,
+        scale: Double,
+        pixelFormat: PixelFormat
+    ) -> Result<RasterizedSvg, ResvgError> {
+        do {
+            switch input {
+            case let .file(url):
+                return try .success(rasterizer.rasterize(file: url, scale: scale, pixelFormat: pixelFormat))
+            case let .data(data):
+                return try .success(rasterizer.rasterize(data: data, scale: scale, pixelFormat: pixelFormat))
+            case let .tree(tree):
+                return try .success(rasterizer.rasterize(tree: tree, scale: scale, pixelFormat: pixelFormat))
+            }
+        } catch let error as ResvgError {
+            return .failure(error)
+        } catch {
+            // Only reading a file can fail with a non-resvg error.
+            if case let .file(url) = input {
+                return .failure(.fileOpenFailed(path: url.path))
+            }
+            return .failure(.unknownError(code: -1))
+        }
+    }
+}
+
+// MARK: - Delivery
+
+extension BatchRasterizer {
+    /// Reorders finished items when input order is requested.
+    struct Delivery {
+        let order: ResultOrder
+        private var nextIndex = 0
+        private var pending: [Int: Item] = [:]
+
+        init(order: ResultOrder) {
+            self.order = order
+        }
+
+        /// Finished items held back for an earlier one.
+        var waiting: Int { pending.count }
+
+        /// Accepts a finished item and returns the items now ready for delivery.
+        mutating func accept(_ item: Item) -> [Item] {
+            guard order == .input else { return [item] }
+
+            pending[item.index] = item
+            var ready: [Item] = []
+            while let next = pending.removeValue(forKey: nextIndex) {
+                ready.append(next)
+                nextIndex += 1
+            }
+            return ready
+        }
+    }
+}
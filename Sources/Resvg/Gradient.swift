@@ -15,11 +15,7 @@ public struct LinearGradient: @unchecked Sendable {
 
     /// The gradient ID.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_linear_gradient_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_linear_gradient_id(ptr, $0) }
     }
 
     /// Start X coordinate.
@@ -96,11 +92,7 @@ public struct RadialGradient: @unchecked Sendable {
 
     /// The gradient ID.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_radial_gradient_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_radial_gradient_id(ptr, $0) }
     }
 
     /// Center X coordinate.
@@ -16,6 +16,16 @@ public struct TreeNode: @unchecked Sendable {
         self.tree = tree
     }
 
+    /// The element ID (from `id` attribute), or empty string if none.
+    public var id: String {
+        NativeString.decode { resvg_node_id(OpaquePointer(ptr), $0) }
+    }
+
+    /// Whether the element ID equals `id`, compared without allocating.
+    public func hasID(_ id: String) -> Bool {
+        NativeString.equals(id) { resvg_node_id(OpaquePointer(ptr), $0) }
+    }
+
     /// The type of this node.
     public var nodeType: NodeType {
         let type = resvg_node_get_type(OpaquePointer(ptr))
@@ -71,11 +81,12 @@ public struct Group: @unchecked Sendable {
 
     /// The element ID (from `id` attribute), or empty string if none.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_group_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_group_id(ptr, $0) }
+    }
+
+    /// Whether the element ID equals `id`, compared without allocating.
+    public func hasID(_ id: String) -> Bool {
+        NativeString.equals(id) { resvg_group_id(ptr, $0) }
     }
 
     /// The relative transform of this group.
@@ -193,11 +204,7 @@ public struct Mask: @unchecked Sendable {
 
     /// The mask ID.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_mask_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_mask_id(ptr, $0) }
     }
 
     /// The mask bounding rectangle.
@@ -245,11 +252,7 @@ public struct ClipPath: @unchecked Sendable {
 
     /// The clip path ID.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_clip_path_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_clip_path_id(ptr, $0) }
     }
 
     /// The clip path transform.
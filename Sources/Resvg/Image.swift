@@ -17,11 +17,12 @@ public struct ImageNode: @unchecked Sendable {
 
     /// The element ID (from `id` attribute), or empty string if none.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_image_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_image_id(ptr, $0) }
+    }
+
+    /// Whether the element ID equals `id`, compared without allocating.
+    public func hasID(_ id: String) -> Bool {
+        NativeString.equals(id) { resvg_image_id(ptr, $0) }
     }
 
     /// The relative transform of this image.
@@ -48,6 +49,40 @@ public struct ImageNode: @unchecked Sendable {
     public var kind: ImageKind {
         ImageKind(rawValue: UInt32(resvg_image_get_kind(ptr).rawValue)) ?? .jpeg
     }
+
+    /// The encoded bytes of a raster image, as embedded or linked.
+    ///
+    /// Copied out of the tree on each access. Nil for SVG images.
+    public var encodedData: Data? {
+        var count: UInt = 0
+        guard let bytes = resvg_image_encoded_data(ptr, &count) else {
+            return nil
+        }
+        return withExtendedLifetime(tree) { Data(bytes: bytes, count: Int(count)) }
+    }
+
+    /// Decodes a JPEG, PNG or GIF image to pixels at its intrinsic size.
+    ///
+    /// Parsing never decodes raster data, so traversal does not pay for it;
+    /// this decodes on every call with the decoders resvg renders with.
+    /// - Returns: Straight RGBA pixels, or nil for SVG and WebP images or
+    ///   undecodable data
+    public func decodedPixels() -> RasterizedSvg? {
+        guard let pixels = withExtendedLifetime(tree, { resvg_image_decode(ptr) }) else {
+            return nil
+        }
+        defer { resvg_image_pixels_destroy(pixels) }
+
+        var count: UInt = 0
+        guard let bytes = resvg_image_pixels_data(pixels, &count) else {
+            return nil
+        }
+        return RasterizedSvg(
+            width: Int(resvg_image_pixels_width(pixels)),
+            height: Int(resvg_image_pixels_height(pixels)),
+            rgba: Array(UnsafeBufferPointer(start: bytes, count: Int(count)))
+        )
+    }
 }
 
 // MARK: - ImageKind
@@ -0,0 +1,28 @@
+import Foundation
+
+/// Strings borrowed from the tree by the `resvg_*_id` functions.
+///
+/// The returned pointers are not NUL-terminated, so they are read using the
+/// returned length.
+enum NativeString {
+    /// Calls `get` with a length out-parameter and decodes the result as UTF-8.
+    static func decode(_ get: (UnsafeMutablePointer<UInt>) -> UnsafePointer<CChar>?) -> String {
+        var len: UInt = 0
+        guard let chars = get(&len), len > 0 else {
+            return ""
+        }
+        return String(decoding: UnsafeRawBufferPointer(start: chars, count: Int(len)), as: UTF8.self)
+    }
+
+    /// Compares the string returned by `get` with `string` byte for byte, without allocating.
+    static func equals(_ string: String, _ get: (UnsafeMutablePointer<UInt>) -> UnsafePointer<CChar>?) -> Bool {
+        var len: UInt = 0
+        let chars = get(&len)
+        var string = string
+        return string.withUTF8 { utf8 in
+            guard utf8.count == Int(len) else { return false }
+            guard let chars, let base = utf8.baseAddress else { return len == 0 }
+            return memcmp(chars, base, utf8.count) == 0
+        }
+    }
+}
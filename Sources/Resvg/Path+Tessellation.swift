@@ -0,0 +1,153 @@
+import CResvg
+import Foundation
+
+// MARK: - Polyline
+
+/// A straight-line approximation of one subpath.
+public struct Polyline: Sendable, Equatable {
+    /// Points in drawing order.
+    public let points: [SIMD2<Float>]
+
+    /// Whether the subpath is closed. The closing segment from the last point
+    /// back to the first is implied, not repeated in `points`.
+    public let isClosed: Bool
+
+    public init(points: [SIMD2<Float>], isClosed: Bool) {
+        self.points = points
+        self.isClosed = isClosed
+    }
+}
+
+// MARK: - TriangleMesh
+
+/// Indexed triangles covering the fill area of a path.
+public struct TriangleMesh: Sendable, Equatable {
+    /// Vertex positions.
+    public let vertices: [SIMD2<Float>]
+
+    /// Three indices into `vertices` per triangle.
+    public let indices: [UInt32]
+
+    /// The number of triangles.
+    public var triangleCount: Int {
+        indices.count / 3
+    }
+
+    public init(vertices: [SIMD2<Float>], indices: [UInt32]) {
+        self.vertices = vertices
+        self.indices = indices
+    }
+}
+
+// MARK: - Flattening and Tessellation
+
+extension Path {
+    /// Flattens the path's curves into one polyline per subpath.
+    ///
+    /// Computed natively in a single call, which avoids reading segments one
+    /// at a time and subdividing curves in Swift.
+    /// - Parameters:
+    ///   - tolerance: Maximum distance between a polyline and its curve, in
+    ///     user units (default: 0.1); must be positive
+    ///   - absolute: Map points through `absoluteTransform` (default: false)
+    /// - Returns: Polylines in subpath order
+    /// - Throws: `ResvgError.invalidTolerance` if `tolerance` is not positive
+    public func flattened(tolerance: Float = 0.1, absolute: Bool = false) throws -> [Polyline] {
+        guard let polylines = resvg_path_flatten(ptr, tolerance, absolute) else {
+            try Self.validate(tolerance: tolerance)
+            return []
+        }
+        defer { resvg_polylines_destroy(polylines) }
+
+        let points = Self.points { resvg_polylines_points(polylines, $0) }
+        let starts = Self.buffer { resvg_polylines_starts(polylines, $0) }
+        let closed = Self.buffer { resvg_polylines_closed(polylines, $0) }
+
+        return starts.indices.map { i in
+            let end = i + 1 < starts.count ? Int(starts[i + 1]) : points.count
+            return Polyline(points: Array(points[Int(starts[i]) ..< end]), isClosed: closed[i] != 0)
+        }
+    }
+
+    /// Tessellates the fill area of the path into indexed triangles.
+    ///
+    /// Computed natively in a single call. Curves are flattened to within
+    /// `tolerance` first.
+    /// - Parameters:
+    ///   - tolerance: Maximum distance between flattened edges and curves, in
+    ///     user units (default: 0.1); must be positive
+    ///   - fillRule: Rule deciding which regions are inside (default: the
+    ///     rule of the path's fill, or `.nonZero` without a fill)
+    ///   - absolute: Map vertices through `absoluteTransform` (default: false)
+    /// - Returns: The triangles, or an empty mesh if tessellation fails
+    /// - Throws: `ResvgError.invalidTolerance` if `tolerance` is not positive
+    public func triangulated(
+        tolerance: Float = 0.1,
+        fillRule: FillRule? = nil,
+        absolute: Bool = false
+    ) throws -> TriangleMesh {
+        let rule = fillRule ?? fill?.rule ?? .nonZero
+        guard let triangles = resvg_path_triangulate(ptr, tolerance, resvg_fill_rule(rawValue: rule.rawValue), absolute)
+        else {
+            try Self.validate(tolerance: tolerance)
+            return TriangleMesh(vertices: [], indices: [])
+        }
+        defer { resvg_triangles_destroy(triangles) }
+
+        return TriangleMesh(
+            vertices: Self.points { resvg_triangles_vertices(triangles, $0) },
+            indices: Array(Self.buffer { resvg_triangles_indices(triangles, $0) })
+        )
+    }
+
+    /// Explains a NULL result: the native side rejects the same tolerances.
+    private static func validate(tolerance: Float) throws {
+        guard tolerance > 0 else {
+            throw ResvgError.invalidTolerance(tolerance)
+        }
+    }
+
+    /// Wraps a native array returned with its length; valid until the owner is destroyed.
+    private static func buffer<T>(_ get: (UnsafeMutablePointer<UInt>) -> UnsafePointer<T>?) -> UnsafeBufferPointer<T> {
+        var count: UInt = 0
+        let base = get(&count)
+        return UnsafeBufferPointer(start: base, count: base == nil ? 0 : Int(count))
+    }
+
+    /// Copies interleaved x/y floats into points.
+    private static func points(_ get: (UnsafeMutablePointer<UInt>) -> UnsafePointer<Float>?) -> [SIMD2<Float>] {
+        let floats = buffer(get)
+        return (0 ..< floats.count / 2).map { SIMD2(floats[2 * $0], floats[2 * $0 + 1]) }
+    }
+}
+
+// MARK: - Stroke Outline
+
+extension Path {
+    /// The filled outline of the path's stroke, with dashes, caps and joins applied.
+    ///
+    /// Computed natively with the same dasher and stroker resvg renders with,
+    /// in the same verb/point layout as `geometry`. Filling the outline with
+    /// the non-zero rule covers exactly the stroked area.
+    /// - Parameter resolution: Scale the outline will be displayed at; larger
+    ///   values produce finer round joins and caps (default: 1)
+    /// - Returns: The outline in the path's coordinates, or nil if the path
+    ///   has no stroke or the stroke is empty
+    /// - Throws: `ResvgError.invalidResolution` if `resolution` is not
+    ///   positive and finite
+    public func strokeOutline(resolution: Float = 1) throws -> PathGeometry? {
+        guard let outline = resvg_path_stroke_outline(ptr, resolution) else {
+            // The native side rejects the same values.
+            guard resolution > 0, resolution.isFinite else {
+                throw ResvgError.invalidResolution(resolution)
+            }
+            return nil
+        }
+        defer { resvg_path_outline_destroy(outline) }
+
+        return PathGeometry(
+            verbs: Array(Self.buffer { resvg_path_outline_verbs(outline, $0) }),
+            points: Self.points { resvg_path_outline_points(outline, $0) }
+        )
+    }
+}
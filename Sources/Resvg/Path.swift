@@ -17,11 +17,12 @@ public struct Path: @unchecked Sendable {
 
     /// The element ID (from `id` attribute), or empty string if none.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_path_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_path_id(ptr, $0) }
+    }
+
+    /// Whether the element ID equals `id`, compared without allocating.
+    public func hasID(_ id: String) -> Bool {
+        NativeString.equals(id) { resvg_path_id(ptr, $0) }
     }
 
     /// The relative transform of this path.
@@ -44,18 +45,40 @@ public struct Path: @unchecked Sendable {
         Int(resvg_path_data_len(ptr))
     }
 
+    /// The number of points in the path data.
+    public var pointCount: Int {
+        Int(resvg_path_data_points_len(ptr))
+    }
+
     /// Get all path segments.
     public var segments: [PathSegment] {
-        let count = segmentCount
-        var result: [PathSegment] = []
-        result.reserveCapacity(count)
-        for i in 0..<count {
-            var seg = resvg_path_segment()
-            if resvg_path_data_segment(ptr, UInt(i), &seg) {
-                result.append(PathSegment(seg))
+        geometry.segments
+    }
+
+    /// The path data as contiguous verb and point arrays.
+    ///
+    /// Copies the whole path in a single call, which is much cheaper than
+    /// reading segments one at a time for large paths.
+    public var geometry: PathGeometry {
+        var verbs = [UInt8](repeating: 0, count: segmentCount)
+        var points = [SIMD2<Float>](repeating: .zero, count: pointCount)
+        let copied = verbs.withUnsafeMutableBufferPointer { verbBuffer in
+            points.withUnsafeMutableBufferPointer { pointBuffer in
+                pointBuffer.withMemoryRebound(to: Float.self) { floats in
+                    resvg_path_data_copy(
+                        ptr,
+                        verbBuffer.baseAddress,
+                        UInt(verbBuffer.count),
+                        floats.baseAddress,
+                        UInt(floats.count)
+                    )
+                }
             }
         }
-        return result
+        guard copied else {
+            return PathGeometry(verbs: [], points: [])
+        }
+        return PathGeometry(verbs: verbs, points: points)
     }
 
     /// Get a segment at a specific index.
@@ -120,6 +143,16 @@ public struct PathSegment: Sendable, Equatable {
     /// Second control point Y (for cubic curves).
     public let y2: Float
 
+    init(type: SegmentType, x: Float, y: Float, x1: Float = 0, y1: Float = 0, x2: Float = 0, y2: Float = 0) {
+        self.type = type
+        self.x = x
+        self.y = y
+        self.x1 = x1
+        self.y1 = y1
+        self.x2 = x2
+        self.y2 = y2
+    }
+
     init(_ seg: resvg_path_segment) {
         self.type = SegmentType(rawValue: UInt32(seg.seg_type.rawValue)) ?? .moveTo
         self.x = seg.x
@@ -140,6 +173,57 @@ public enum SegmentType: UInt32, Sendable {
     case close = 4
 }
 
+// MARK: - PathGeometry
+
+/// Path data in struct-of-arrays form.
+///
+/// `verbs` holds one `SegmentType` raw value per segment. `points` holds the
+/// points consumed by the verbs, in order: one for moveTo and lineTo, two for
+/// quadTo (control, end), three for cubicTo (control 1, control 2, end) and
+/// none for close.
+public struct PathGeometry: Sendable, Equatable {
+    /// Segment verbs as `SegmentType` raw values.
+    public let verbs: [UInt8]
+
+    /// Points consumed by the verbs.
+    public let points: [SIMD2<Float>]
+
+    public init(verbs: [UInt8], points: [SIMD2<Float>]) {
+        self.verbs = verbs
+        self.points = points
+    }
+
+    /// The geometry expanded into `PathSegment` values.
+    public var segments: [PathSegment] {
+        var result: [PathSegment] = []
+        result.reserveCapacity(verbs.count)
+        var index = 0
+        for verb in verbs {
+            let type = SegmentType(rawValue: UInt32(verb)) ?? .close
+            switch type {
+            case .moveTo, .lineTo:
+                let p = points[index]
+                result.append(PathSegment(type: type, x: p.x, y: p.y))
+                index += 1
+            case .quadTo:
+                let p1 = points[index]
+                let p = points[index + 1]
+                result.append(PathSegment(type: type, x: p.x, y: p.y, x1: p1.x, y1: p1.y))
+                index += 2
+            case .cubicTo:
+                let p1 = points[index]
+                let p2 = points[index + 1]
+                let p = points[index + 2]
+                result.append(PathSegment(type: type, x: p.x, y: p.y, x1: p1.x, y1: p1.y, x2: p2.x, y2: p2.y))
+                index += 3
+            case .close:
+                result.append(PathSegment(type: .close, x: 0, y: 0))
+            }
+        }
+        return result
+    }
+}
+
 // MARK: - Fill
 
 /// Fill properties of a path.
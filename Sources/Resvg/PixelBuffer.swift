@@ -0,0 +1,85 @@
+import Foundation
+
+// MARK: - PixelBuffer
+
+/// A reusable pixel buffer for rendering without per-image allocations.
+///
+/// The underlying storage grows to fit the largest image rendered into it
+/// and is never shrunk, so a render loop that reuses one buffer stops
+/// allocating once it has seen its largest image.
+///
+/// Not thread-safe: use one buffer per thread or task.
+///
+/// Example usage:
+/// ```swift
+/// let buffer = PixelBuffer()
+/// for tree in trees {
+///     try rasterizer.rasterize(tree: tree, into: buffer)
+///     buffer.withUnsafeBytes { upload($0, buffer.width, buffer.height) }
+/// }
+/// ```
+public final class PixelBuffer {
+    /// Width of the last rendered image in pixels.
+    public private(set) var width = 0
+
+    /// Height of the last rendered image in pixels.
+    public private(set) var height = 0
+
+    /// Layout of the last rendered image.
+    public private(set) var pixelFormat: PixelFormat = .straightRGBA
+
+    /// Allocated storage in bytes.
+    public private(set) var capacity = 0
+
+    private var storage: UnsafeMutableRawPointer?
+
+    /// Creates a buffer, optionally preallocating storage.
+    ///
+    /// - Parameter capacity: Initial storage in bytes
+    public init(capacity: Int = 0) {
+        reserveCapacity(capacity)
+    }
+
+    deinit {
+        storage?.deallocate()
+    }
+
+    /// Row stride in bytes (rows are tightly packed).
+    public var bytesPerRow: Int { width * PixelFormat.bytesPerPixel }
+
+    /// Number of bytes used by the last rendered image.
+    public var byteCount: Int { bytesPerRow * height }
+
+    /// Grows storage to at least `byteCount` bytes. Never shrinks.
+    public func reserveCapacity(_ byteCount: Int) {
+        guard byteCount > capacity else { return }
+        // Contents are always overwritten by the next render, so nothing is copied.
+        storage?.deallocate()
+        storage = UnsafeMutableRawPointer.allocate(byteCount: byteCount, alignment: 16)
+        capacity = byteCount
+    }
+
+    /// Gives read access to the pixels of the last rendered image.
+    public func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try body(UnsafeRawBufferPointer(start: storage, count: byteCount))
+    }
+
+    /// Gives write access to the pixels of the last rendered image.
+    public func withUnsafeMutableBytes<R>(_ body: (UnsafeMutableRawBufferPointer) throws -> R) rethrows -> R {
+        try body(UnsafeMutableRawBufferPointer(start: storage, count: byteCount))
+    }
+
+    /// Copies the last rendered image into a standalone `RasterizedSvg`.
+    public func makeRasterizedSvg() -> RasterizedSvg {
+        let pixels = withUnsafeBytes { [UInt8]($0) }
+        return RasterizedSvg(width: width, height: height, rgba: pixels, pixelFormat: pixelFormat)
+    }
+
+    /// Sets the dimensions for the next render, growing storage if needed.
+    func prepare(width: Int, height: Int, pixelFormat: PixelFormat) {
+        reserveCapacity(width * height * PixelFormat.bytesPerPixel)
+        self.width = width
+        self.height = height
+        self.pixelFormat = pixelFormat
+    }
+}
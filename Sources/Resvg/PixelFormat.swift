@@ -0,0 +1,127 @@
+import Foundation
+
+// MARK: - PixelFormat
+
+/// Memory layout of rasterized pixels.
+public enum PixelFormat: Sendable, Hashable {
+    /// Premultiplied RGBA, as produced by resvg. Skips the unpremultiply pass.
+    case premultipliedRGBA
+
+    /// Straight (unpremultiplied) RGBA.
+    case straightRGBA
+
+    /// Straight (unpremultiplied) BGRA.
+    case straightBGRA
+
+    /// Bytes per pixel (always 4).
+    public static let bytesPerPixel = 4
+
+    /// Converts premultiplied RGBA pixels in place to this format.
+    ///
+    /// Rounding matches a straight `Float` division by alpha, truncated.
+    /// - Parameter pixels: Premultiplied RGBA pixel data; trailing bytes that
+    ///   do not form a whole pixel are left untouched
+    public func convertFromPremultipliedRGBA(_ pixels: UnsafeMutableRawBufferPointer) {
+        switch self {
+        case .premultipliedRGBA:
+            break
+        case .straightRGBA:
+            PixelConversion.unpremultiply(pixels, swapRedBlue: false)
+        case .straightBGRA:
+            PixelConversion.unpremultiply(pixels, swapRedBlue: true)
+        }
+    }
+}
+
+// MARK: - PixelConversion
+
+/// Vectorized premultiplied-to-straight alpha conversion.
+///
+/// Pixels are processed four at a time as `SIMD4<UInt32>` (little-endian RGBA,
+/// so alpha is the high byte). Blocks where every pixel is fully opaque or fully
+/// transparent need no division and are skipped or only swizzled. Remaining pixels
+/// use a 256x256 lookup table indexed by alpha and channel value, built with the
+/// same expression as the original per-pixel loop so results are bit-exact.
+enum PixelConversion {
+    /// `table[alpha << 8 | value]` is the straight value for a premultiplied channel.
+    static let unpremultiplyTable: [UInt8] = {
+        var table = [UInt8](repeating: 0, count: 256 * 256)
+        for alpha in 0 ..< 256 {
+            for value in 0 ..< 256 {
+                let index = alpha << 8 | value
+                if alpha > 0, alpha < 255 {
+                    let alphaFloat = Float(alpha) / 255.0
+                    table[index] = UInt8(min(255, Float(value) / alphaFloat))
+                } else {
+                    table[index] = UInt8(value)
+                }
+            }
+        }
+        return table
+    }()
+
+    static func unpremultiply(_ pixels: UnsafeMutableRawBufferPointer, swapRedBlue: Bool) {
+        guard let base = pixels.baseAddress else { return }
+        let pixelCount = pixels.count / PixelFormat.bytesPerPixel
+
+        unpremultiplyTable.withUnsafeBufferPointer { table in
+            var index = 0
+
+            while index + 4 <= pixelCount {
+                let offset = index * PixelFormat.bytesPerPixel
+                index += 4
+
+                var block = base.loadUnaligned(fromByteOffset: offset, as: SIMD4<UInt32>.self)
+                let alpha = block &>> 24
+                let trivial = (alpha .== 0) .| (alpha .== 255)
+
+                if all(trivial) {
+                    guard swapRedBlue else { continue }
+                } else {
+                    for lane in 0 ..< 4 where !trivial[lane] {
+                        block[lane] = unpremultiplied(block[lane], table: table)
+                    }
+                }
+
+                if swapRedBlue {
+                    block = swappingRedBlue(block)
+                }
+                base.storeBytes(of: block, toByteOffset: offset, as: SIMD4<UInt32>.self)
+            }
+
+            while index < pixelCount {
+                let offset = index * PixelFormat.bytesPerPixel
+                index += 1
+
+                var pixel = unpremultiplied(
+                    base.loadUnaligned(fromByteOffset: offset, as: UInt32.self),
+                    table: table
+                )
+                if swapRedBlue {
+                    pixel = swappingRedBlue(pixel)
+                }
+                base.storeBytes(of: pixel, toByteOffset: offset, as: UInt32.self)
+            }
+        }
+    }
+
+    @inline(__always)
+    private static func unpremultiplied(_ pixel: UInt32, table: UnsafeBufferPointer<UInt8>) -> UInt32 {
+        let alpha = pixel >> 24
+        let row = Int(alpha) << 8
+        let r = UInt32(table[row | Int(pixel & 0xFF)])
+        let g = UInt32(table[row | Int((pixel >> 8) & 0xFF)])
+        let b = UInt32(table[row | Int((pixel >> 16) & 0xFF)])
+        return r | g << 8 | b << 16 | alpha << 24
+    }
+
+    @inline(__always)
+    private static func swappingRedBlue(_ pixel: UInt32) -> UInt32 {
+        (pixel & 0xFF00_FF00) | (pixel & 0xFF) << 16 | (pixel >> 16) & 0xFF
+    }
+
+    @inline(__always)
+    private static func swappingRedBlue(_ block: SIMD4<UInt32>) -> SIMD4<UInt32> {
+        (block & 0xFF00_FF00) | (block & 0xFF) &<< 16 | (block &>> 16) & 0xFF
+    }
+}
@@ -0,0 +1,405 @@
+import Foundation
+
+// MARK: - RenderCache
+
+/// A content-addressed cache of rendered images.
+///
+/// Entries are keyed by a 128-bit hash of the SVG bytes, the context's options,
+/// the scale and the pixel format. A hit skips parsing and rendering entirely.
+///
+/// The memory tier is an LRU bounded by pixel bytes. The optional disk tier
+/// stores raw pixels, one file per entry, and reads them memory-mapped; it is
+/// never evicted automatically, so point it at a cache directory the system
+/// may purge.
+///
+/// The hash is fast but not cryptographic: do not share a disk tier with
+/// untrusted writers.
+///
+/// Example usage:
+/// ```swift
+/// let cache = try RenderCache(memoryLimit: 128 * 1024 * 1024, directory: cachesURL)
+/// let rasterizer = SvgRasterizer(context: context, cache: cache)
+/// let icon = try rasterizer.rasterize(data: svgData, scale: 2)
+/// print(cache.statistics.hits)
+/// ```
+public final class RenderCache: @unchecked Sendable {
+    /// Cache counters.
+    public struct Statistics: Sendable, Equatable {
+        /// Lookups served from memory or disk.
+        public var hits = 0
+
+        /// Hits served from the disk tier (included in `hits`).
+        public var diskHits = 0
+
+        /// Lookups that required rendering.
+        public var misses = 0
+
+        /// Entries evicted from memory to stay within `memoryLimit`.
+        public var evictions = 0
+
+        /// Entries currently held in memory.
+        public var entryCount = 0
+
+        /// Pixel bytes currently held in memory.
+        public var byteCount = 0
+    }
+
+    /// Maximum pixel bytes held in memory.
+    public let memoryLimit: Int
+
+    /// Directory of the disk tier, if any.
+    public let directory: URL?
+
+    private let lock = NSLock()
+    private var entries: [Key: Node] = [:]
+    private var newest: Node?
+    private var oldest: Node?
+    private var stats = Statistics()
+
+    /// Creates a cache.
+    ///
+    /// - Parameters:
+    ///   - memoryLimit: Maximum pixel bytes held in memory (default: 64 MiB)
+    ///   - directory: Directory for the disk tier, created if needed (default: memory only)
+    /// - Throws: `ResvgError.fileOpenFailed` if the directory cannot be created
+    public init(memoryLimit: Int = 64 * 1024 * 1024, directory: URL? = nil) throws {
+        if let directory {
+            do {
+                try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+            } catch {
+                throw ResvgError.fileOpenFailed(path: directory.path)
+            }
+        }
+        self.memoryLimit = max(0, memoryLimit)
+        self.directory = directory
+    }
+
+    /// A snapshot of the cache counters.
+    public var statistics: Statistics {
+        lock.withLock { stats }
+    }
+
+    /// Removes all entries from memory. Files of the disk tier are kept.
+    public func removeAll() {
+        lock.withLock {
+            entries.removeAll()
+            newest = nil
+            oldest = nil
+            stats.entryCount = 0
+            stats.byteCount = 0
+        }
+    }
+
+    /// Returns the cached image for `key`, promoting disk entries to memory.
+    func image(for key: Key) -> RasterizedSvg? {
+        let cached: RasterizedSvg? = lock.withLock {
+            guard let node = entries[key] else { return nil }
+            moveToFront(node)
+            stats.hits += 1
+            return node.image
+        }
+        if let cached {
+            return cached
+        }
+
+        if let image = readFromDisk(key) {
+            lock.withLock {
+                stats.hits += 1
+                stats.diskHits += 1
+                store(image, for: key)
+            }
+            return image
+        }
+
+        lock.withLock { stats.misses += 1 }
+        return nil
+    }
+
+    /// Stores a freshly rendered image in memory and on disk.
+    func insert(_ image: RasterizedSvg, for key: Key) {
+        lock.withLock { store(image, for: key) }
+        writeToDisk(image, for: key)
+    }
+
+    // MARK: - Memory Tier
+
+    private final class Node {
+        let key: Key
+        let image: RasterizedSvg
+        var newer: Node?
+        var older: Node?
+
+        init(key: Key, image: RasterizedSvg) {
+            self.key = key
+            self.image = image
+        }
+    }
+
+    /// Must be called with `lock` held.
+    private func store(_ image: RasterizedSvg, for key: Key) {
+        guard entries[key] == nil, image.byteCount <= memoryLimit else { return }
+
+        let node = Node(key: key, image: image)
+        entries[key] = node
+        link(node)
+        stats.entryCount += 1
+        stats.byteCount += image.byteCount
+
+        while stats.byteCount > memoryLimit, let victim = oldest {
+            unlink(victim)
+            entries[victim.key] = nil
+            stats.entryCount -= 1
+            stats.byteCount -= victim.image.byteCount
+            stats.evictions += 1
+        }
+    }
+
+    private func moveToFront(_ node: Node) {
+        guard newest !== node else { return }
+        unlink(node)
+        link(node)
+    }
+
+    private func link(_ node: Node) {
+        node.older = newest
+        node.newer = nil
+        newest?.newer = node
+        newest = node
+        if oldest == nil {
+            oldest = node
+        }
+    }
+
+    private func unlink(_ node: Node) {
+        node.newer?.older = node.older
+        node.older?.newer = node.newer
+        if newest === node {
+            newest = node.older
+        }
+        if oldest === node {
+            oldest = node.newer
+        }
+        node.newer = nil
+        node.older = nil
+    }
+
+    // MARK: - Disk Tier
+
+    /// File layout: magic, width, height, pixel format, then raw pixels.
+    private static let magic: UInt32 = 0x4352_5352 // "RSRC" little-endian
+    private static let headerSize = 16
+
+    private func fileURL(for key: Key) -> URL? {
+        directory?.appendingPathComponent(key.fileName, isDirectory: false)
+    }
+
+    /// Reads an entry, deleting files that are truncated or corrupt.
+    private func readFromDisk(_ key: Key) -> RasterizedSvg? {
+        guard let url = fileURL(for: key), let data = try? Data(contentsOf: url, options: .alwaysMapped) else {
+            return nil
+        }
+
+        let image = data.withUnsafeBytes { bytes -> RasterizedSvg? in
+            guard bytes.count >= Self.headerSize else { return nil }
+            let header = (0 ..< 4).map {
+                UInt32(littleEndian: bytes.loadUnaligned(fromByteOffset: $0 * 4, as: UInt32.self))
+            }
+            let width = Int(header[1])
+            let height = Int(header[2])
+            // The header is untrusted; a huge size must not trap.
+            let (pixelCount, pixelOverflow) = width.multipliedReportingOverflow(by: height)
+            let (byteCount, byteOverflow) = pixelCount.multipliedReportingOverflow(by: PixelFormat.bytesPerPixel)
+            guard header[0] == Self.magic,
+                  let pixelFormat = PixelFormat(cacheCode: header[3]),
+                  !pixelOverflow, !byteOverflow,
+                  bytes.count - Self.headerSize == byteCount
+            else {
+                return nil
+            }
+            let pixels = [UInt8](UnsafeRawBufferPointer(rebasing: bytes[Self.headerSize...]))
+            return RasterizedSvg(width: width, height: height, rgba: pixels, pixelFormat: pixelFormat)
+        }
+        if image == nil {
+            try? FileManager.default.removeItem(at: url)
+        }
+        return image
+    }
+
+    private func writeToDisk(_ image: RasterizedSvg, for key: Key) {
+        guard let url = fileURL(for: key) else { return }
+
+        var data = Data(capacity: Self.headerSize + image.byteCount)
+        for field in [Self.magic, UInt32(image.width), UInt32(image.height), image.pixelFormat.cacheCode] {
+            withUnsafeBytes(of: field.littleEndian) { data.append(contentsOf: $0) }
+        }
+        data.append(contentsOf: image.rgba)
+        // Best effort: a failed write only costs a future re-render.
+        try? data.write(to: url, options: .atomic)
+    }
+}
+
+// MARK: - Key
+
+extension RenderCache {
+    /// Identifies one rendered output.
+    struct Key: Hashable, Sendable {
+        let content: ContentHash
+        let options: ContentHash
+        let scale: Double
+        let pixelFormat: PixelFormat
+
+        init(data: Data, context: RenderContext, scale: Double, pixelFormat: PixelFormat) {
+            self.content = ContentHash(data)
+            self.options = context.optionsDigest
+            self.scale = scale
+            self.pixelFormat = pixelFormat
+        }
+
+        /// Stable file name derived from every field.
+        var fileName: String {
+            var fields = Data()
+            for word in [content.high, content.low, options.high, options.low, scale.bitPattern,
+                         UInt64(pixelFormat.cacheCode)] {
+                withUnsafeBytes(of: word.littleEndian) { fields.append(contentsOf: $0) }
+            }
+            return ContentHash(fields).hexString + ".rgba"
+        }
+    }
+}
+
+extension PixelFormat {
+    var cacheCode: UInt32 {
+        switch self {
+        case .premultipliedRGBA: 0
+        case .straightRGBA: 1
+        case .straightBGRA: 2
+        }
+    }
+
+    init?(cacheCode: UInt32) {
+        switch cacheCode {
+        case 0: self = .premultipliedRGBA
+        case 1: self = .straightRGBA
+        case 2: self = .straightBGRA
+        default: return nil
+        }
+    }
+}
+
+// MARK: - ContentHash
+
+/// A fast, stable 128-bit hash of a byte buffer.
+///
+/// Two independent 64-bit lanes consume the input a word at a time and are
+/// finished with the MurmurHash3 avalanche step. Unlike `Hasher`, the result
+/// is identical across processes, so it can name files on disk.
+struct ContentHash: Hashable, Sendable {
+    let high: UInt64
+    let low: UInt64
+
+    init(_ data: Data) {
+        self = data.withUnsafeBytes { ContentHash($0) }
+    }
+
+    init(_ bytes: UnsafeRawBufferPointer) {
+        var h1: UInt64 = 0x9E37_79B9_7F4A_7C15 ^ UInt64(bytes.count)
+        var h2: UInt64 = 0xC2B2_AE3D_27D4_EB4F &+ UInt64(bytes.count)
+        let wordCount = bytes.count / 8
+
+        for index in 0 ..< wordCount {
+            let word = UInt64(littleEndian: bytes.loadUnaligned(fromByteOffset: index * 8, as: UInt64.self))
+            h1 = Self.rotate(h1 ^ (word &* 0x87C3_7B91_1142_53D5), 27) &* 0x5851_F42D_4C95_7F2D &+ 0x52DC_E729
+            h2 = Self.rotate(h2 &+ (word &* 0x4CF5_AD43_2745_937F), 31) &* 0x9FB2_1C65_1E98_DF25 &+ 0x3849_5AB5
+        }
+
+        var tail: UInt64 = 0
+        for (shift, byte) in bytes[(wordCount * 8)...].enumerated() {
+            tail |= UInt64(byte) << (shift * 8)
+        }
+        h1 ^= tail &* 0x87C3_7B91_1142_53D5
+        h2 ^= tail &* 0x4CF5_AD43_2745_937F
+
+        h1 = Self.avalanche(h1 &+ h2)
+        h2 = Self.avalanche(h2 &+ h1)
+        self.high = h1
+        self.low = h2
+    }
+
+    /// 32 lowercase hex digits.
+    var hexString: String {
+        [high, low].map { word in
+            let digits = String(word, radix: 16)
+            return String(repeating: "0", count: 16 - digits.count) + digits
+        }.joined()
+    }
+
+    @inline(__always)
+    private static func rotate(_ value: UInt64, _ count: UInt64) -> UInt64 {
+        value << count | value >> (64 - count)
+    }
+
+    private static func avalanche(_ value: UInt64) -> UInt64 {
+        var h = value
+        h ^= h >> 33
+        h &*= 0xFF51_AFD7_ED55_8CCD
+        h ^= h >> 33
+        h &*= 0xC4CE_B9FE_1A85_EC53
+        h ^= h >> 33
+        return h
+    }
+}
+
+// MARK: - Options Digest
+
+extension RenderOptions {
+    /// A stable hash of every option that affects parsing or rendering.
+    var cacheDigest: ContentHash {
+        var encoded = Data()
+
+        func appendWord(_ value: UInt64) {
+            withUnsafeBytes(of: value.littleEndian) { encoded.append(contentsOf: $0) }
+        }
+        func appendBytes(_ bytes: Data?) {
+            guard let bytes else {
+                appendWord(UInt64.max)
+                return
+            }
+            appendWord(UInt64(bytes.count))
+            encoded.append(bytes)
+        }
+        func appendString(_ string: String?) {
+            appendBytes(string.map { Data($0.utf8) })
+        }
+        func appendOptional(_ value: UInt32?) {
+            appendWord(value.map { UInt64($0) } ?? UInt64.max)
+        }
+
+        appendString(resourcesDirectory?.path)
+        appendOptional(dpi?.bitPattern)
+        appendString(stylesheet)
+        appendString(fontFamily)
+        appendOptional(fontSize?.bitPattern)
+        appendString(serifFamily)
+        appendString(sansSerifFamily)
+        appendString(cursiveFamily)
+        appendString(fantasyFamily)
+        appendString(monospaceFamily)
+        appendString(languages?.joined(separator: ","))
+        appendOptional(shapeRendering?.rawValue)
+        appendOptional(textRendering?.rawValue)
+        appendOptional(imageRendering?.rawValue)
+        appendWord(UInt64(quality.rawValue))
+        appendWord(UInt64(imageLoading.rawValue))
+        appendWord(loadsSystemFonts ? 1 : 0)
+        appendWord(UInt64(fontFiles.count))
+        for url in fontFiles {
+            appendString(url.path)
+        }
+        appendWord(UInt64(fontData.count))
+        for data in fontData {
+            appendBytes(data)
+        }
+
+        return ContentHash(encoded)
+    }
+}
@@ -0,0 +1,376 @@
+import CResvg
+import Foundation
+
+// MARK: - RenderOptions
+
+/// Options used when parsing SVG documents.
+///
+/// Properties left as `nil` keep the resvg defaults.
+public struct RenderOptions: Sendable, Hashable {
+    /// Directory used to resolve relative image paths.
+    public var resourcesDirectory: URL?
+
+    /// Target DPI, used to convert units like `mm` and `in` (default: 96).
+    public var dpi: Float?
+
+    /// A CSS stylesheet applied to every document before parsing.
+    public var stylesheet: String?
+
+    /// Default font family (default: Times New Roman).
+    public var fontFamily: String?
+
+    /// Default font size (default: 12).
+    public var fontSize: Float?
+
+    /// Font family used for the `serif` generic family.
+    public var serifFamily: String?
+
+    /// Font family used for the `sans-serif` generic family.
+    public var sansSerifFamily: String?
+
+    /// Font family used for the `cursive` generic family.
+    public var cursiveFamily: String?
+
+    /// Font family used for the `fantasy` generic family.
+    public var fantasyFamily: String?
+
+    /// Font family used for the `monospace` generic family.
+    public var monospaceFamily: String?
+
+    /// Languages used to resolve `systemLanguage` (default: `["en"]`).
+    public var languages: [String]?
+
+    /// Default shape rendering mode.
+    public var shapeRendering: ShapeRendering?
+
+    /// Default text rendering mode.
+    public var textRendering: TextRendering?
+
+    /// Default image rendering mode.
+    public var imageRendering: ImageRendering?
+
+    /// Speed/quality trade-off; the modes above override it when set (default: `.best`).
+    public var quality: RenderQuality
+
+    /// How `<image>` elements are loaded while parsing (default: `.eager`).
+    public var imageLoading: ImageLoading
+
+    /// Whether to load all system fonts into the font database.
+    public var loadsSystemFonts: Bool
+
+    /// Font files to load into the font database.
+    public var fontFiles: [URL]
+
+    /// Raw font data (TTF/OTF/TTC) to load into the font database.
+    public var fontData: [Data]
+
+    public init(
+        resourcesDirectory: URL? = nil,
+        dpi: Float? = nil,
+        stylesheet: String? = nil,
+        fontFamily: String? = nil,
+        fontSize: Float? = nil,
+        serifFamily: String? = nil,
+        sansSerifFamily: String? = nil,
+        cursiveFamily: String? = nil,
+        fantasyFamily: String? = nil,
+        monospaceFamily: String? = nil,
+        languages: [String]? = nil,
+        shapeRendering: ShapeRendering? = nil,
+        textRendering: TextRendering? = nil,
+        imageRendering: ImageRendering? = nil,
+        quality: RenderQuality = .best,
+        imageLoading: ImageLoading = .eager,
+        loadsSystemFonts: Bool = false,
+        fontFiles: [URL] = [],
+        fontData: [Data] = []
+    ) {
+        self.resourcesDirectory = resourcesDirectory
+        self.dpi = dpi
+        self.stylesheet = stylesheet
+        self.fontFamily = fontFamily
+        self.fontSize = fontSize
+        self.serifFamily = serifFamily
+        self.sansSerifFamily = sansSerifFamily
+        self.cursiveFamily = cursiveFamily
+        self.fantasyFamily = fantasyFamily
+        self.monospaceFamily = monospaceFamily
+        self.languages = languages
+        self.shapeRendering = shapeRendering
+        self.textRendering = textRendering
+        self.imageRendering = imageRendering
+        self.quality = quality
+        self.imageLoading = imageLoading
+        self.loadsSystemFonts = loadsSystemFonts
+        self.fontFiles = fontFiles
+        self.fontData = fontData
+    }
+}
+
+// MARK: - RenderQuality
+
+/// Speed/quality trade-off, mapped onto resvg's default rendering modes.
+///
+/// The modes are applied while parsing, so they affect trees parsed with a
+/// context, not trees that already exist. Elements with their own
+/// `shape-rendering`, `text-rendering` or `image-rendering` keep them.
+public enum RenderQuality: UInt32, Sendable {
+    /// Aliased shapes and text, nearest-neighbor image sampling.
+    /// For thumbnails and live previews.
+    case preview = 0
+
+    /// Anti-aliased shapes and text, nearest-neighbor image sampling.
+    case balanced = 1
+
+    /// resvg defaults: anti-aliasing everywhere and smooth image sampling.
+    /// For final export.
+    case best = 2
+
+    /// Default `shape-rendering`, or nil for the resvg default.
+    var shapeRendering: ShapeRendering? {
+        self == .preview ? .optimizeSpeed : nil
+    }
+
+    /// Default `text-rendering`, or nil for the resvg default.
+    var textRendering: TextRendering? {
+        self == .preview ? .optimizeSpeed : nil
+    }
+
+    /// Default `image-rendering`, or nil for the resvg default.
+    var imageRendering: ImageRendering? {
+        self == .best ? nil : .optimizeSpeed
+    }
+}
+
+// MARK: - ImageLoading
+
+/// How `<image>` elements are loaded while parsing.
+public enum ImageLoading: UInt32, Sendable {
+    /// Read linked files and parse nested SVG images while parsing (resvg
+    /// default). Raster pixels are only decoded when rendered or requested
+    /// with `ImageNode.decodedPixels()`.
+    case eager = 0
+
+    /// Leave images out of the tree. Linked files are not read, nested SVG
+    /// documents are not parsed and embedded bytes are released right away.
+    /// For trees that are only traversed or normalized; images are missing
+    /// from rendered and normalized output.
+    case skip = 1
+
+    var cValue: resvg_image_loading {
+        switch self {
+        case .eager: RESVG_IMAGE_LOADING_EAGER
+        case .skip: RESVG_IMAGE_LOADING_SKIP
+        }
+    }
+}
+
+// MARK: - Rendering Modes
+
+/// Default `shape-rendering` mode.
+public enum ShapeRendering: UInt32, Sendable {
+    case optimizeSpeed = 0
+    case crispEdges = 1
+    case geometricPrecision = 2
+}
+
+/// Default `text-rendering` mode.
+public enum TextRendering: UInt32, Sendable {
+    case optimizeSpeed = 0
+    case optimizeLegibility = 1
+    case geometricPrecision = 2
+}
+
+/// Default `image-rendering` mode.
+public enum ImageRendering: UInt32, Sendable {
+    case optimizeQuality = 0
+    case optimizeSpeed = 1
+}
+
+extension ShapeRendering {
+    var cValue: resvg_shape_rendering {
+        switch self {
+        case .optimizeSpeed: RESVG_SHAPE_RENDERING_OPTIMIZE_SPEED
+        case .crispEdges: RESVG_SHAPE_RENDERING_CRISP_EDGES
+        case .geometricPrecision: RESVG_SHAPE_RENDERING_GEOMETRIC_PRECISION
+        }
+    }
+}
+
+extension TextRendering {
+    var cValue: resvg_text_rendering {
+        switch self {
+        case .optimizeSpeed: RESVG_TEXT_RENDERING_OPTIMIZE_SPEED
+        case .optimizeLegibility: RESVG_TEXT_RENDERING_OPTIMIZE_LEGIBILITY
+        case .geometricPrecision: RESVG_TEXT_RENDERING_GEOMETRIC_PRECISION
+        }
+    }
+}
+
+extension ImageRendering {
+    var cValue: resvg_image_rendering {
+        switch self {
+        case .optimizeQuality: RESVG_IMAGE_RENDERING_OPTIMIZE_QUALITY
+        case .optimizeSpeed: RESVG_IMAGE_RENDERING_OPTIMIZE_SPEED
+        }
+    }
+}
+
+// MARK: - RenderContext
+
+/// A reusable, configured set of resvg options.
+///
+/// Creating options and loading fonts is expensive, especially with
+/// `loadsSystemFonts`. A context does this once and can be shared by
+/// `SvgRasterizer`, `SvgTree` and `SvgNormalizer` across any number of
+/// documents and threads.
+///
+/// A context is immutable after creation, so concurrent parsing is safe.
+///
+/// Example usage:
+/// ```swift
+/// let context = try RenderContext(options: RenderOptions(loadsSystemFonts: true))
+/// let rasterizer = SvgRasterizer(context: context)
+/// for url in urls {
+///     let image = try rasterizer.rasterize(file: url)
+/// }
+/// ```
+public final class RenderContext: @unchecked Sendable {
+    /// A shared context with default options and an empty font database.
+    public static let `default`: RenderContext = {
+        // Default options load no fonts, so creation cannot fail.
+        try! RenderContext()
+    }()
+
+    /// Shared contexts with default options at each quality.
+    private static let presets: [RenderQuality: RenderContext] = [
+        .preview: try! RenderContext(options: RenderOptions(quality: .preview)),
+        .balanced: try! RenderContext(options: RenderOptions(quality: .balanced)),
+        .best: .default,
+    ]
+
+    /// A shared context with default options at the given quality.
+    public static func preset(_ quality: RenderQuality) -> RenderContext {
+        presets[quality]!
+    }
+
+    /// The options this context was created with.
+    public let options: RenderOptions
+
+    let ptr: OpaquePointer
+
+    /// Stable hash of `options`, used to key `RenderCache` entries.
+    let optionsDigest: ContentHash
+
+    /// Creates a context and loads the configured fonts.
+    ///
+    /// - Parameter options: Parsing options
+    /// - Throws: `ResvgError` if a font file cannot be loaded
+    public init(options: RenderOptions = RenderOptions()) throws {
+        guard let opt = resvg_options_create() else {
+            throw ResvgError.unknownError(code: -1)
+        }
+
+        if let dir = options.resourcesDirectory {
+            resvg_options_set_resources_dir(opt, dir.path)
+        }
+        if let dpi = options.dpi {
+            resvg_options_set_dpi(opt, dpi)
+        }
+        if let stylesheet = options.stylesheet {
+            resvg_options_set_stylesheet(opt, stylesheet)
+        }
+        if let family = options.fontFamily {
+            resvg_options_set_font_family(opt, family)
+        }
+        if let size = options.fontSize {
+            resvg_options_set_font_size(opt, size)
+        }
+        if let family = options.serifFamily {
+            resvg_options_set_serif_family(opt, family)
+        }
+        if let family = options.sansSerifFamily {
+            resvg_options_set_sans_serif_family(opt, family)
+        }
+        if let family = options.cursiveFamily {
+            resvg_options_set_cursive_family(opt, family)
+        }
+        if let family = options.fantasyFamily {
+            resvg_options_set_fantasy_family(opt, family)
+        }
+        if let family = options.monospaceFamily {
+            resvg_options_set_monospace_family(opt, family)
+        }
+        if let languages = options.languages {
+            resvg_options_set_languages(opt, languages.joined(separator: ","))
+        }
+        if let mode = options.shapeRendering ?? options.quality.shapeRendering {
+            resvg_options_set_shape_rendering_mode(opt, mode.cValue)
+        }
+        if let mode = options.textRendering ?? options.quality.textRendering {
+            resvg_options_set_text_rendering_mode(opt, mode.cValue)
+        }
+        if let mode = options.imageRendering ?? options.quality.imageRendering {
+            resvg_options_set_image_rendering_mode(opt, mode.cValue)
+        }
+        if options.imageLoading != .eager {
+            resvg_options_set_image_loading(opt, options.imageLoading.cValue)
+        }
+
+        if options.loadsSystemFonts {
+            resvg_options_load_system_fonts(opt)
+        }
+        for url in options.fontFiles {
+            let result = resvg_options_load_font_file(opt, url.path)
+            if result != Int32(RESVG_OK.rawValue) {
+                resvg_options_destroy(opt)
+                throw ResvgError.fileOpenFailed(path: url.path)
+            }
+        }
+        for data in options.fontData {
+            data.withUnsafeBytes { ptr in
+                guard let baseAddress = ptr.baseAddress else { return }
+                resvg_options_load_font_data(
+                    opt,
+                    baseAddress.assumingMemoryBound(to: CChar.self),
+                    UInt(ptr.count)
+                )
+            }
+        }
+
+        self.options = options
+        self.optionsDigest = options.cacheDigest
+        self.ptr = opt
+    }
+
+    deinit {
+        resvg_options_destroy(ptr)
+    }
+
+    /// Parses SVG data into a native render tree.
+    ///
+    /// The caller owns the returned tree and must destroy it with `resvg_tree_destroy`.
+    func parseTree(_ data: Data) throws -> OpaquePointer {
+        var tree: OpaquePointer?
+        let result = data.withUnsafeBytes { ptr -> Int32 in
+            guard let baseAddress = ptr.baseAddress else {
+                return Int32(RESVG_ERROR_PARSING_FAILED.rawValue)
+            }
+            return resvg_parse_tree_from_data(
+                baseAddress.assumingMemoryBound(to: CChar.self),
+                UInt(ptr.count),
+                self.ptr,
+                &tree
+            )
+        }
+
+        if let error = ResvgError.fromCode(result) {
+            throw error
+        }
+
+        guard let tree else {
+            throw ResvgError.parsingFailed
+        }
+        return tree
+    }
+}
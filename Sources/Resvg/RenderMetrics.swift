@@ -0,0 +1,155 @@
+import CResvg
+import Foundation
+#if canImport(os)
+import os
+#endif
+
+// MARK: - RenderMetrics
+
+/// Where the time of one rasterization went.
+///
+/// Delivered to `SvgRasterizer.metricsHandler` after each single-image
+/// `file:`, `data:` and `tree:` rasterization. Phases that did not run report 0.
+public struct RenderMetrics: Sendable, Equatable {
+    /// A timed step of rasterization.
+    public enum Phase: Sendable, CaseIterable {
+        /// Reading or mapping the SVG file.
+        case load
+        /// Parsing into a tree (`resvg_parse_tree_from_data`).
+        case parse
+        /// Rendering premultiplied pixels (`resvg_render`).
+        case render
+        /// Converting to the requested `PixelFormat`, e.g. unpremultiplying.
+        case pixelConversion
+    }
+
+    /// Time spent reading the file, in nanoseconds.
+    public internal(set) var loadNanoseconds: UInt64 = 0
+
+    /// Time spent parsing, in nanoseconds.
+    public internal(set) var parseNanoseconds: UInt64 = 0
+
+    /// Time spent in resvg's renderer, in nanoseconds.
+    public internal(set) var renderNanoseconds: UInt64 = 0
+
+    /// Time spent converting pixels, in nanoseconds.
+    public internal(set) var pixelConversionNanoseconds: UInt64 = 0
+
+    /// Bytes allocated for the output pixels; 0 when rendering into caller memory.
+    public internal(set) var pixmapBytes = 0
+
+    /// Nodes in the rendered tree, excluding the root; 0 on a cache hit.
+    public internal(set) var nodeCount = 0
+
+    /// Output width in pixels.
+    public internal(set) var width = 0
+
+    /// Output height in pixels.
+    public internal(set) var height = 0
+
+    /// Whether the image came from the rasterizer's `RenderCache`.
+    public internal(set) var cacheHit = false
+
+    /// Time spent in the given phase, in nanoseconds.
+    public func nanoseconds(for phase: Phase) -> UInt64 {
+        switch phase {
+        case .load: loadNanoseconds
+        case .parse: parseNanoseconds
+        case .render: renderNanoseconds
+        case .pixelConversion: pixelConversionNanoseconds
+        }
+    }
+
+    /// Time spent in all phases, in nanoseconds.
+    public var totalNanoseconds: UInt64 {
+        Phase.allCases.reduce(0) { $0 + nanoseconds(for: $1) }
+    }
+
+    mutating func add(_ nanoseconds: UInt64, to phase: Phase) {
+        switch phase {
+        case .load: loadNanoseconds += nanoseconds
+        case .parse: parseNanoseconds += nanoseconds
+        case .render: renderNanoseconds += nanoseconds
+        case .pixelConversion: pixelConversionNanoseconds += nanoseconds
+        }
+    }
+}
+
+// MARK: - MetricsRecorder
+
+/// Collects `RenderMetrics` for one call.
+///
+/// Only created when a handler is installed; every hook is reached through an
+/// optional, so rasterization without a handler does no timing at all. On
+/// Apple platforms each phase is also emitted as an `os_signpost` interval
+/// for Instruments.
+final class MetricsRecorder {
+    #if canImport(os)
+    private static let signposter = OSSignposter(subsystem: "swift-resvg", category: "Rasterization")
+    private var interval: OSSignpostIntervalState?
+    #endif
+
+    private let handler: @Sendable (RenderMetrics) -> Void
+    private var metrics = RenderMetrics()
+    private var phaseStart: UInt64 = 0
+
+    init(handler: @escaping @Sendable (RenderMetrics) -> Void) {
+        self.handler = handler
+    }
+
+    func begin(_ phase: RenderMetrics.Phase) {
+        #if canImport(os)
+        interval = Self.signposter.beginInterval(phase.signpostName)
+        #endif
+        phaseStart = DispatchTime.now().uptimeNanoseconds
+    }
+
+    func end(_ phase: RenderMetrics.Phase) {
+        metrics.add(DispatchTime.now().uptimeNanoseconds - phaseStart, to: phase)
+        #if canImport(os)
+        if let interval {
+            Self.signposter.endInterval(phase.signpostName, interval)
+        }
+        interval = nil
+        #endif
+    }
+
+    func recordAllocation(bytes: Int) {
+        metrics.pixmapBytes += bytes
+    }
+
+    /// Records the output and counts the nodes of `tree`.
+    func recordOutput(width: Int, height: Int, tree: OpaquePointer) {
+        metrics.width = width
+        metrics.height = height
+        let list = resvg_tree_collect_nodes(tree, SvgTree.allNodeTypes)
+        defer { resvg_node_list_destroy(list) }
+        var count: UInt = 0
+        _ = resvg_node_list_items(list, &count)
+        metrics.nodeCount = Int(count)
+    }
+
+    func recordCacheHit(_ image: RasterizedSvg) {
+        metrics.cacheHit = true
+        metrics.width = image.width
+        metrics.height = image.height
+    }
+
+    /// Delivers the metrics to the handler.
+    func report() {
+        handler(metrics)
+    }
+}
+
+#if canImport(os)
+extension RenderMetrics.Phase {
+    var signpostName: StaticString {
+        switch self {
+        case .load: "load"
+        case .parse: "parse"
+        case .render: "render"
+        case .pixelConversion: "pixelConversion"
+        }
+    }
+}
+#endif
@@ -12,6 +12,15 @@ public enum ResvgError: LocalizedError, Equatable, Sendable {
     case unknownError(code: Int32)
     case emptyImage
     case svgExportFailed
+    case bufferTooSmall(required: Int, actual: Int)
+    case invalidRowStride(bytesPerRow: Int)
+    case regionOutOfBounds(PixelRegion)
+    case deadlineExceeded
+    case encodingFailed
+    case nodeNotFound(id: String)
+    case invalidResolvedDocument
+    case invalidTolerance(Float)
+    case invalidResolution(Float)
 
     /// Creates a ResvgError from a resvg error code
     /// - Parameter code: The error code from resvg C API
@@ -57,6 +66,24 @@ public enum ResvgError: LocalizedError, Equatable, Sendable {
             "SVG has no renderable elements"
         case .svgExportFailed:
             "Failed to export normalized SVG"
+        case let .bufferTooSmall(required, actual):
+            "Pixel buffer is too small (\(actual) bytes, \(required) required)"
+        case let .invalidRowStride(bytesPerRow):
+            "Invalid row stride: \(bytesPerRow) bytes per row"
+        case let .regionOutOfBounds(region):
+            "Region \(region.width)x\(region.height) at (\(region.x), \(region.y)) is empty or outside the image"
+        case .deadlineExceeded:
+            "Rendering did not finish before its deadline"
+        case .encodingFailed:
+            "Failed to encode the rendered image"
+        case let .nodeNotFound(id):
+            "No renderable node with ID '\(id)'"
+        case .invalidResolvedDocument:
+            "Data is not a resolved document of a supported version"
+        case let .invalidTolerance(tolerance):
+            "Tolerance must be positive (got \(tolerance))"
+        case let .invalidResolution(resolution):
+            "Resolution must be positive and finite (got \(resolution))"
         }
     }
 
@@ -80,6 +107,24 @@ public enum ResvgError: LocalizedError, Equatable, Sendable {
             "Ensure the SVG contains visible elements"
         case .svgExportFailed:
             "SVG may contain unsupported features"
+        case .bufferTooSmall:
+            "Size the buffer with SvgRasterizer.outputSize(of:scale:)"
+        case .invalidRowStride:
+            "Use a multiple of 4 that is at least width * 4"
+        case .regionOutOfBounds:
+            "Keep the region within SvgRasterizer.outputSize(of:scale:)"
+        case .deadlineExceeded:
+            "Allow more time, or render at a smaller scale or in tiles"
+        case .encodingFailed:
+            "The image may be too large for the format; try a smaller scale"
+        case .nodeNotFound:
+            "Check the ID; elements inside <defs> or without visible content are not rendered"
+        case .invalidResolvedDocument:
+            "Write it again with SvgTree.resolvedDocument() from this library version"
+        case .invalidTolerance:
+            "Use a small positive value, such as the default 0.1"
+        case .invalidResolution:
+            "Pass the scale the outline will be displayed at, such as the default 1"
         }
     }
 }
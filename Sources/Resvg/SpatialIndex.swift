@@ -0,0 +1,192 @@
+import CResvg
+import Foundation
+
+// MARK: - SpatialIndex
+
+/// An R-tree over the bounding boxes of a tree's nodes.
+///
+/// Built once from a single native traversal, then answers point and
+/// rectangle queries in logarithmic time instead of walking every node.
+/// Keep the index for as long as the tree is used; it retains the tree.
+///
+/// Results are in document order, so for hit-testing the last node is the
+/// topmost one. Boxes are in canvas coordinates, the same space as
+/// `SvgTree.size`.
+///
+/// Example usage:
+/// ```swift
+/// let index = SpatialIndex(tree: tree)
+/// if let hit = index.nodes(atX: 120, y: 48).last?.asPath() {
+///     print("Clicked", hit.id)
+/// }
+/// let visible = index.nodes(in: tile, scale: 2)
+/// ```
+public final class SpatialIndex: @unchecked Sendable {
+    /// Which bounding box of a node is indexed.
+    public enum Bounds: Sendable {
+        /// The object bounding box, without stroke.
+        case object
+        /// The bounding box including stroke.
+        case stroke
+    }
+
+    /// Children per R-tree node.
+    static let fanOut = 16
+
+    /// The indexed tree.
+    public let tree: SvgTree
+
+    /// Node pointers in document order.
+    private let pointers: [UnsafeRawPointer]
+
+    /// Levels of boxes, leaves first. Box `i` of level `k > 0` covers boxes
+    /// `i * fanOut ..< (i + 1) * fanOut` of level `k - 1`.
+    private let levels: [[IndexBox]]
+
+    /// Document-order position of each leaf box.
+    private let leafOrder: [Int32]
+
+    /// Builds an index over the nodes of the given types.
+    ///
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - types: Node types to index (default: paths, images and text)
+    ///   - bounds: Which bounding box to index (default: `.stroke`)
+    public init(tree: SvgTree, types: [NodeType] = [.path, .image, .text], bounds: Bounds = .stroke) {
+        self.tree = tree
+        let typeMask = types.reduce(UInt32(0)) { $0 | 1 << $1.rawValue }
+
+        var pointers: [UnsafeRawPointer] = []
+        var rects: [resvg_rect] = []
+        tree.withNodeList(typeMask: typeMask) { list, items in
+            pointers = items
+            rects = [resvg_rect](repeating: resvg_rect(), count: items.count)
+            let written = rects.withUnsafeMutableBufferPointer {
+                resvg_node_list_bboxes(list, bounds == .stroke, $0.baseAddress, UInt($0.count))
+            }
+            if !written {
+                pointers = []
+                rects = []
+            }
+        }
+        self.pointers = pointers
+
+        let (leaves, leafOrder) = Self.sortTileRecursive(rects.map { IndexBox($0) })
+        self.leafOrder = leafOrder
+        var levels = [leaves]
+        while let last = levels.last, last.count > 1 {
+            levels.append(stride(from: 0, to: last.count, by: Self.fanOut).map { start in
+                last[start ..< min(start + Self.fanOut, last.count)].reduce(IndexBox.empty) { $0.union($1) }
+            })
+        }
+        self.levels = levels
+    }
+
+    /// Number of indexed nodes.
+    public var count: Int {
+        pointers.count
+    }
+
+    /// Nodes whose box contains the point, in document order.
+    public func nodes(atX x: Float, y: Float) -> [TreeNode] {
+        query(IndexBox(minX: x, minY: y, maxX: x, maxY: y))
+    }
+
+    /// Nodes whose box intersects `rect`, in document order.
+    public func nodes(intersecting rect: Rect) -> [TreeNode] {
+        query(IndexBox(rect))
+    }
+
+    /// Nodes that intersect a region of the image rendered at `scale`.
+    ///
+    /// Use it to skip work for nodes outside a tile or viewport.
+    /// - Parameters:
+    ///   - region: Rectangle in output pixels
+    ///   - scale: Scale factor the image is rendered at (1.0 = native size)
+    public func nodes(in region: PixelRegion, scale: Double = 1.0) -> [TreeNode] {
+        query(IndexBox(
+            minX: Float(Double(region.x) / scale),
+            minY: Float(Double(region.y) / scale),
+            maxX: Float(Double(region.x + region.width) / scale),
+            maxY: Float(Double(region.y + region.height) / scale)
+        ))
+    }
+
+    private func query(_ box: IndexBox) -> [TreeNode] {
+        guard let top = levels.last, !top.isEmpty else {
+            return []
+        }
+        var hits: [Int32] = []
+        var stack: [(level: Int, index: Int)] = top.indices.map { (levels.count - 1, $0) }
+        while let entry = stack.popLast() {
+            guard levels[entry.level][entry.index].intersects(box) else { continue }
+            if entry.level == 0 {
+                hits.append(leafOrder[entry.index])
+            } else {
+                let start = entry.index * Self.fanOut
+                for child in start ..< min(start + Self.fanOut, levels[entry.level - 1].count) {
+                    stack.append((entry.level - 1, child))
+                }
+            }
+        }
+        return hits.sorted().map { TreeNode(pointers[Int($0)], tree: tree) }
+    }
+
+    /// Orders boxes for bulk loading (Sort-Tile-Recursive): vertical slices by
+    /// center x, each sorted by center y, so every run of `fanOut` boxes is compact.
+    private static func sortTileRecursive(_ boxes: [IndexBox]) -> ([IndexBox], [Int32]) {
+        var order = boxes.indices.sorted { boxes[$0].centerX < boxes[$1].centerX }
+        let leafCount = (boxes.count + fanOut - 1) / fanOut
+        let sliceCount = max(1, Int(Double(leafCount).squareRoot().rounded(.up)))
+        let sliceSize = sliceCount * fanOut
+        for start in stride(from: 0, to: order.count, by: sliceSize) {
+            let range = start ..< min(start + sliceSize, order.count)
+            order[range].sort { boxes[$0].centerY < boxes[$1].centerY }
+        }
+        return (order.map { boxes[$0] }, order.map { Int32($0) })
+    }
+}
+
+// MARK: - IndexBox
+
+/// An axis-aligned box stored by its extremes for cheap intersection tests.
+struct IndexBox {
+    var minX: Float
+    var minY: Float
+    var maxX: Float
+    var maxY: Float
+
+    static let empty = IndexBox(minX: .infinity, minY: .infinity, maxX: -.infinity, maxY: -.infinity)
+
+    init(minX: Float, minY: Float, maxX: Float, maxY: Float) {
+        self.minX = minX
+        self.minY = minY
+        self.maxX = maxX
+        self.maxY = maxY
+    }
+
+    init(_ rect: Rect) {
+        self.init(minX: rect.x, minY: rect.y, maxX: rect.x + rect.width, maxY: rect.y + rect.height)
+    }
+
+    init(_ rect: resvg_rect) {
+        self.init(Rect(rect))
+    }
+
+    var centerX: Float { (minX + maxX) / 2 }
+    var centerY: Float { (minY + maxY) / 2 }
+
+    func union(_ other: IndexBox) -> IndexBox {
+        IndexBox(
+            minX: min(minX, other.minX),
+            minY: min(minY, other.minY),
+            maxX: max(maxX, other.maxX),
+            maxY: max(maxY, other.maxY)
+        )
+    }
+
+    /// Edges touching counts as intersecting, so points on a boundary hit.
+    func intersects(_ other: IndexBox) -> Bool {
+        minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY
+    }
+}
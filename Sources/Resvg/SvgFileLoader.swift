@@ -0,0 +1,25 @@
+import Foundation
+
+/// Reads SVG files for the `file:` entry points.
+///
+/// Files at or above `mappingThreshold` are memory-mapped read-only and the
+/// mapped bytes are handed to the parser directly, so a large export is not
+/// duplicated on the heap. Smaller files are read normally, which is cheaper
+/// than setting up a mapping.
+enum SvgFileLoader {
+    /// Minimum file size in bytes that is memory-mapped.
+    static let mappingThreshold = 64 * 1024
+
+    /// Loads a file, mapping it when it is large enough.
+    ///
+    /// - Throws: `ResvgError.fileOpenFailed` if the file cannot be read
+    static func load(_ url: URL) throws -> Data {
+        do {
+            let size = try url.resourceValues(forKeys: [.fileSizeKey]).fileSize ?? 0
+            let options: Data.ReadingOptions = size >= mappingThreshold ? .alwaysMapped : []
+            return try Data(contentsOf: url, options: options)
+        } catch {
+            throw ResvgError.fileOpenFailed(path: url.path)
+        }
+    }
+}
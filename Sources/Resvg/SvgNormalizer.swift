@@ -13,75 +13,217 @@ import Foundation
 /// This produces a simplified SVG that can be parsed without
 /// needing full SVG/CSS spec compliance.
 public struct SvgNormalizer: Sendable {
-    public init() {}
+    /// The context providing parsing options and fonts.
+    public let context: RenderContext
+
+    /// Creates a normalizer.
+    ///
+    /// - Parameter context: Shared parsing options and fonts (default: `RenderContext.default`)
+    public init(context: RenderContext = .default) {
+        self.context = context
+    }
 
     /// Normalizes SVG data using usvg
     ///
-    /// - Parameter data: Raw SVG data (UTF-8 or gzip compressed)
+    /// - Parameters:
+    ///   - data: Raw SVG data (UTF-8 or gzip compressed)
+    ///   - options: Output formatting (default: usvg defaults, indented)
     /// - Returns: Normalized SVG data as UTF-8
     /// - Throws: `ResvgError` on parsing or export failure
-    public func normalize(_ data: Data) throws -> Data {
-        // Create options
-        guard let opt = resvg_options_create() else {
-            throw ResvgError.unknownError(code: -1)
-        }
-        defer { resvg_options_destroy(opt) }
-
-        // Parse SVG tree
-        var tree: OpaquePointer?
-        let result = data.withUnsafeBytes { ptr -> Int32 in
-            guard let baseAddress = ptr.baseAddress else {
-                return Int32(RESVG_ERROR_PARSING_FAILED.rawValue)
-            }
-            return resvg_parse_tree_from_data(
-                baseAddress.assumingMemoryBound(to: CChar.self),
-                UInt(ptr.count),
-                opt,
-                &tree
-            )
-        }
-
-        // Check for parsing errors
-        if let error = ResvgError.fromCode(result) {
-            throw error
+    public func normalize(_ data: Data, options: SvgWriteOptions = .default) throws -> Data {
+        var output = Data()
+        try normalize(data, options: options, chunkSize: 0) { chunk in
+            output.append(contentsOf: chunk)
         }
+        return output
+    }
 
-        guard let tree else {
-            throw ResvgError.parsingFailed
-        }
+    /// Normalizes SVG data and streams the output in chunks
+    ///
+    /// The normalized document is never copied as a whole on the Swift side,
+    /// so peak memory stays at one copy plus one chunk.
+    /// - Parameters:
+    ///   - data: Raw SVG data (UTF-8 or gzip compressed)
+    ///   - options: Output formatting (default: usvg defaults, indented)
+    ///   - chunkSize: Maximum bytes per chunk, or 0 for a single chunk (default: 64 KiB)
+    ///   - body: Receives each chunk of UTF-8 output; the buffer is only valid during the call
+    /// - Throws: `ResvgError` on parsing or export failure, or the error thrown by `body`
+    public func normalize(
+        _ data: Data,
+        options: SvgWriteOptions = .default,
+        chunkSize: Int = 64 * 1024,
+        to body: (UnsafeRawBufferPointer) throws -> Void
+    ) throws {
+        let tree = try context.parseTree(data)
         defer { resvg_tree_destroy(tree) }
+        try SvgWriter.write(tree, options: options, chunkSize: chunkSize, to: body)
+    }
 
-        // Export normalized SVG
-        var len: UInt = 0
-        guard let svgPtr = resvg_tree_to_svg(tree, &len) else {
-            throw ResvgError.svgExportFailed
+    /// Normalizes SVG data and writes the output to a file handle
+    ///
+    /// - Parameters:
+    ///   - data: Raw SVG data (UTF-8 or gzip compressed)
+    ///   - options: Output formatting (default: usvg defaults, indented)
+    ///   - handle: Destination, e.g. a file or pipe
+    /// - Throws: `ResvgError` on parsing or export failure, or the write error
+    public func normalize(_ data: Data, options: SvgWriteOptions = .default, to handle: FileHandle) throws {
+        try normalize(data, options: options) { chunk in
+            try handle.write(contentsOf: chunk)
         }
-        defer { resvg_svg_string_destroy(svgPtr) }
-
-        // Copy to Swift Data
-        return Data(bytes: svgPtr, count: Int(len))
     }
 
     /// Normalizes SVG from a file
     ///
-    /// - Parameter url: Path to SVG file
+    /// - Parameters:
+    ///   - url: Path to SVG file
+    ///   - options: Output formatting (default: usvg defaults, indented)
     /// - Returns: Normalized SVG data as UTF-8
     /// - Throws: `ResvgError` on parsing or export failure
-    public func normalize(file url: URL) throws -> Data {
-        let data = try Data(contentsOf: url)
-        return try normalize(data)
+    public func normalize(file url: URL, options: SvgWriteOptions = .default) throws -> Data {
+        let data = try SvgFileLoader.load(url)
+        return try normalize(data, options: options)
     }
 
     /// Normalizes SVG and returns as String
     ///
-    /// - Parameter data: Raw SVG data (UTF-8 or gzip compressed)
+    /// - Parameters:
+    ///   - data: Raw SVG data (UTF-8 or gzip compressed)
+    ///   - options: Output formatting (default: usvg defaults, indented)
     /// - Returns: Normalized SVG as UTF-8 string
     /// - Throws: `ResvgError` on parsing or export failure
-    public func normalizeToString(_ data: Data) throws -> String {
-        let normalized = try normalize(data)
+    public func normalizeToString(_ data: Data, options: SvgWriteOptions = .default) throws -> String {
+        let normalized = try normalize(data, options: options)
         guard let string = String(data: normalized, encoding: .utf8) else {
             throw ResvgError.notUtf8String
         }
         return string
     }
 }
+
+// MARK: - SvgWriteOptions
+
+/// Formatting of normalized SVG output, mirroring `usvg::WriteOptions`.
+public struct SvgWriteOptions: Sendable, Hashable {
+    /// Indentation of elements or attributes.
+    public enum Indent: Sendable, Hashable {
+        /// No line breaks or indentation.
+        case none
+
+        /// The given number of spaces per level (0 to 255).
+        case spaces(Int)
+
+        /// One tab per level.
+        case tabs
+    }
+
+    /// Indentation of nested elements (default: 4 spaces).
+    public var indent: Indent
+
+    /// Indentation of attributes; `.none` keeps them on the element's line (default).
+    public var attributesIndent: Indent
+
+    /// Decimal places written for coordinates (default: 8).
+    public var coordinatesPrecision: Int
+
+    /// Decimal places written for transforms (default: 8).
+    public var transformsPrecision: Int
+
+    /// Quote attribute values with `'` instead of `"`.
+    public var usesSingleQuotes: Bool
+
+    /// Keep `<text>` elements instead of writing them as paths.
+    public var preservesText: Bool
+
+    /// Prefix for IDs that usvg generates, e.g. for gradients and clip paths.
+    public var idPrefix: String?
+
+    /// The usvg defaults.
+    public static let `default` = SvgWriteOptions()
+
+    /// No whitespace between elements and fewer decimal places.
+    public static let minified = SvgWriteOptions(indent: .none, coordinatesPrecision: 3, transformsPrecision: 5)
+
+    public init(
+        indent: Indent = .spaces(4),
+        attributesIndent: Indent = .none,
+        coordinatesPrecision: Int = 8,
+        transformsPrecision: Int = 8,
+        usesSingleQuotes: Bool = false,
+        preservesText: Bool = false,
+        idPrefix: String? = nil
+    ) {
+        self.indent = indent
+        self.attributesIndent = attributesIndent
+        self.coordinatesPrecision = coordinatesPrecision
+        self.transformsPrecision = transformsPrecision
+        self.usesSingleQuotes = usesSingleQuotes
+        self.preservesText = preservesText
+        self.idPrefix = idPrefix
+    }
+}
+
+extension SvgWriteOptions.Indent {
+    var cValue: Int32 {
+        switch self {
+        case .none: RESVG_INDENT_NONE
+        case let .spaces(count): Int32(clamping: min(max(count, 0), 255))
+        case .tabs: RESVG_INDENT_TABS
+        }
+    }
+}
+
+// MARK: - SvgWriter
+
+/// Streams a native tree through `resvg_tree_write_svg`.
+enum SvgWriter {
+    private struct Sink {
+        let body: (UnsafeRawBufferPointer) throws -> Void
+        var error: Error?
+    }
+
+    static func write(
+        _ tree: OpaquePointer,
+        options: SvgWriteOptions,
+        chunkSize: Int,
+        to body: (UnsafeRawBufferPointer) throws -> Void
+    ) throws {
+        let succeeded = try withoutActuallyEscaping(body) { body in
+            var sink = Sink(body: body)
+            let succeeded = withOptionalCString(options.idPrefix) { idPrefix in
+                var cOptions = resvg_write_options(
+                    indent: options.indent.cValue,
+                    attributes_indent: options.attributesIndent.cValue,
+                    coordinates_precision: UInt8(clamping: options.coordinatesPrecision),
+                    transforms_precision: UInt8(clamping: options.transformsPrecision),
+                    use_single_quote: options.usesSingleQuotes,
+                    preserve_text: options.preservesText,
+                    id_prefix: idPrefix
+                )
+                return withUnsafeMutablePointer(to: &sink) { sinkPointer in
+                    resvg_tree_write_svg(tree, &cOptions, UInt(max(chunkSize, 0)), { data, len, context in
+                        let sink = context!.assumingMemoryBound(to: Sink.self)
+                        do {
+                            try sink.pointee.body(UnsafeRawBufferPointer(start: data, count: Int(len)))
+                            return true
+                        } catch {
+                            sink.pointee.error = error
+                            return false
+                        }
+                    }, sinkPointer)
+                }
+            }
+            if let error = sink.error {
+                throw error
+            }
+            return succeeded
+        }
+        guard succeeded else {
+            throw ResvgError.svgExportFailed
+        }
+    }
+
+    private static func withOptionalCString<T>(_ string: String?, _ body: (UnsafePointer<CChar>?) -> T) -> T {
+        guard let string else { return body(nil) }
+        return string.withCString(body)
+    }
+}
@@ -0,0 +1,275 @@
+import CResvg
+import Foundation
+
+// MARK: - RenderWork
+
+/// Runs blocking resvg work off the cooperative thread pool.
+///
+/// Parsing cannot be interrupted inside resvg, so the work checks
+/// `checkpoint()` between phases and before each node of a render. Task
+/// cancellation and the deadline take effect at the next checkpoint.
+final class RenderWork: @unchecked Sendable {
+    private static let queue = DispatchQueue.global(qos: .userInitiated)
+
+    let deadline: DispatchTime
+    private let lock = NSLock()
+    private var cancelled = false
+
+    init(deadline: DispatchTime) {
+        self.deadline = deadline
+    }
+
+    func cancel() {
+        lock.withLock { cancelled = true }
+    }
+
+    /// Throws if the task was cancelled or the deadline has passed.
+    /// - Throws: `CancellationError` or `ResvgError.deadlineExceeded`
+    func checkpoint() throws {
+        if lock.withLock({ cancelled }) {
+            throw CancellationError()
+        }
+        if DispatchTime.now() >= deadline {
+            throw ResvgError.deadlineExceeded
+        }
+    }
+
+    /// Runs `body` on a dispatch queue, cancelling it when the calling task is cancelled.
+    static func run<T: Sendable>(
+        deadline: DispatchTime,
+        _ body: @escaping @Sendable (RenderWork) throws -> T
+    ) async throws -> T {
+        let work = RenderWork(deadline: deadline)
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                queue.async {
+                    continuation.resume(with: Result {
+                        try work.checkpoint()
+                        return try body(work)
+                    })
+                }
+            }
+        } onCancel: {
+            work.cancel()
+        }
+    }
+}
+
+// MARK: - Async Rasterization
+
+extension SvgRasterizer {
+    /// Rasterizes SVG data without blocking the cooperative thread pool
+    ///
+    /// Parsing and rendering run on a dispatch queue. Task cancellation and
+    /// `deadline` are checked between parsing and rendering and before each
+    /// node is drawn, so a huge render stops soon after either fires. The
+    /// output is identical to the synchronous `rasterize(data:scale:pixelFormat:)`.
+    /// - Parameters:
+    ///   - data: SVG file data (UTF-8 string or gzip compressed)
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - deadline: Time after which work stops; pass `.distantFuture` for none
+    /// - Returns: Rasterized image with width, height, and RGBA bytes
+    /// - Throws: `CancellationError`, `ResvgError.deadlineExceeded` or another `ResvgError`
+    public func rasterize(
+        data: Data,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA,
+        deadline: DispatchTime
+    ) async throws -> RasterizedSvg {
+        try await RenderWork.run(deadline: deadline) { work in
+            try rasterize(data: data, scale: scale, pixelFormat: pixelFormat, work: work)
+        }
+    }
+
+    /// Rasterizes an SVG file without blocking the cooperative thread pool
+    ///
+    /// See `rasterize(data:scale:pixelFormat:deadline:)`. The file is read on
+    /// the dispatch queue too.
+    /// - Parameters:
+    ///   - url: Path to SVG file
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - deadline: Time after which work stops; pass `.distantFuture` for none
+    /// - Returns: Rasterized image with width, height, and RGBA bytes
+    /// - Throws: `CancellationError`, `ResvgError.deadlineExceeded` or another `ResvgError`
+    public func rasterize(
+        file url: URL,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA,
+        deadline: DispatchTime
+    ) async throws -> RasterizedSvg {
+        try await RenderWork.run(deadline: deadline) { work in
+            let data = try SvgFileLoader.load(url)
+            try work.checkpoint()
+            return try rasterize(data: data, scale: scale, pixelFormat: pixelFormat, work: work)
+        }
+    }
+
+    /// Rasterizes an already parsed SVG tree without blocking the cooperative thread pool
+    ///
+    /// See `rasterize(data:scale:pixelFormat:deadline:)`.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - deadline: Time after which work stops; pass `.distantFuture` for none
+    /// - Returns: Rasterized image with width, height, and RGBA bytes
+    /// - Throws: `CancellationError`, `ResvgError.deadlineExceeded` or another `ResvgError`
+    public func rasterize(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA,
+        deadline: DispatchTime
+    ) async throws -> RasterizedSvg {
+        try await RenderWork.run(deadline: deadline) { work in
+            try render(tree, scale: scale, pixelFormat: pixelFormat, work: work)
+        }
+    }
+
+    /// Parses and renders on the calling thread, consulting the cache.
+    private func rasterize(
+        data: Data,
+        scale: Double,
+        pixelFormat: PixelFormat,
+        work: RenderWork
+    ) throws -> RasterizedSvg {
+        let key = cache.map { _ in
+            RenderCache.Key(data: data, context: context, scale: scale, pixelFormat: pixelFormat)
+        }
+        if let cache, let key, let image = cache.image(for: key) {
+            return image
+        }
+
+        let tree = try SvgTree(data: data, context: context)
+        try work.checkpoint()
+        let image = try render(tree, scale: scale, pixelFormat: pixelFormat, work: work)
+        if let cache, let key {
+            cache.insert(image, for: key)
+        }
+        return image
+    }
+
+    /// Renders the whole canvas in one pass, checking `work` before each node.
+    ///
+    /// Unlike rendering in bands, this draws with the same transform and clip
+    /// as the synchronous path, so the pixels are identical.
+    private func render(
+        _ tree: SvgTree,
+        scale: Double,
+        pixelFormat: PixelFormat,
+        work: RenderWork
+    ) throws -> RasterizedSvg {
+        try withExtendedLifetime(tree) {
+            let (width, height) = try Self.pixelSize(tree.ptr, scale: scale)
+            var pixmap = [UInt8](repeating: 0, count: width * height * PixelFormat.bytesPerPixel)
+
+            let finished = pixmap.withUnsafeMutableBytes { bytes in
+                withExtendedLifetime(work) {
+                    resvg_render_interruptible(
+                        tree.ptr,
+                        Self.scaleTransform(scale),
+                        UInt32(width),
+                        UInt32(height),
+                        bytes.baseAddress!.assumingMemoryBound(to: CChar.self),
+                        { context in
+                            let work = Unmanaged<RenderWork>.fromOpaque(context!).takeUnretainedValue()
+                            return (try? work.checkpoint()) != nil
+                        },
+                        Unmanaged.passUnretained(work).toOpaque()
+                    )
+                }
+            }
+            guard finished else {
+                // A checkpoint failed; cancellation and deadlines stay failed.
+                try work.checkpoint()
+                throw ResvgError.invalidSize
+            }
+
+            pixmap.withUnsafeMutableBytes { pixelFormat.convertFromPremultipliedRGBA($0) }
+            return RasterizedSvg(width: width, height: height, rgba: pixmap, pixelFormat: pixelFormat)
+        }
+    }
+}
+
+// MARK: - Async Parsing
+
+extension SvgTree {
+    /// Parses SVG data without blocking the cooperative thread pool
+    ///
+    /// Parsing cannot be interrupted; cancellation and `deadline` are checked
+    /// before it starts and after it finishes.
+    /// - Parameters:
+    ///   - data: Raw SVG data (UTF-8 or gzip compressed)
+    ///   - context: Shared parsing options and fonts (default: `RenderContext.default`)
+    ///   - deadline: Time after which work stops; pass `.distantFuture` for none
+    /// - Returns: The parsed tree
+    /// - Throws: `CancellationError`, `ResvgError.deadlineExceeded` or another `ResvgError`
+    public static func parse(
+        data: Data,
+        context: RenderContext = .default,
+        deadline: DispatchTime
+    ) async throws -> SvgTree {
+        try await RenderWork.run(deadline: deadline) { work in
+            let tree = try SvgTree(data: data, context: context)
+            try work.checkpoint()
+            return tree
+        }
+    }
+
+    /// Parses an SVG file without blocking the cooperative thread pool
+    ///
+    /// The file is read on the dispatch queue, before parsing.
+    /// - Parameters:
+    ///   - url: Path to SVG file
+    ///   - context: Shared parsing options and fonts (default: `RenderContext.default`)
+    ///   - deadline: Time after which work stops; pass `.distantFuture` for none
+    /// - Returns: The parsed tree
+    /// - Throws: `CancellationError`, `ResvgError.deadlineExceeded` or another `ResvgError`
+    public static func parse(
+        file url: URL,
+        context: RenderContext = .default,
+        deadline: DispatchTime
+    ) async throws -> SvgTree {
+        try await RenderWork.run(deadline: deadline) { work in
+            let data = try SvgFileLoader.load(url)
+            try work.checkpoint()
+            let tree = try SvgTree(data: data, context: context)
+            try work.checkpoint()
+            return tree
+        }
+    }
+}
+
+// MARK: - Async Normalization
+
+extension SvgNormalizer {
+    /// Normalizes SVG data without blocking the cooperative thread pool
+    ///
+    /// Cancellation and `deadline` are checked after parsing and between
+    /// 64 KiB chunks of output.
+    /// - Parameters:
+    ///   - data: Raw SVG data (UTF-8 or gzip compressed)
+    ///   - options: Output formatting (default: usvg defaults, indented)
+    ///   - deadline: Time after which work stops; pass `.distantFuture` for none
+    /// - Returns: Normalized SVG data as UTF-8
+    /// - Throws: `CancellationError`, `ResvgError.deadlineExceeded` or another `ResvgError`
+    public func normalize(
+        _ data: Data,
+        options: SvgWriteOptions = .default,
+        deadline: DispatchTime
+    ) async throws -> Data {
+        try await RenderWork.run(deadline: deadline) { work in
+            let tree = try context.parseTree(data)
+            defer { resvg_tree_destroy(tree) }
+            try work.checkpoint()
+
+            var output = Data()
+            try SvgWriter.write(tree, options: options, chunkSize: 64 * 1024) { chunk in
+                try work.checkpoint()
+                output.append(contentsOf: chunk)
+            }
+            return output
+        }
+    }
+}
@@ -0,0 +1,142 @@
+import CResvg
+import Foundation
+
+// MARK: - SpriteAtlas
+
+/// Several nodes of one tree rendered side by side into a single image.
+public struct SpriteAtlas: Sendable {
+    /// The packed image.
+    public let image: RasterizedSvg
+
+    /// Where each requested ID was rendered in `image`.
+    public let regions: [String: PixelRegion]
+}
+
+// MARK: - Atlas Rendering
+
+extension SvgRasterizer {
+    /// Rasterizes the nodes with the given IDs into one atlas image
+    ///
+    /// Each node is sized by its layer bounding box (stroke and filters
+    /// included), packed onto shelves, and rendered once into its slot of a
+    /// single buffer. This replaces cropping a full render or parsing the
+    /// document once per icon.
+    ///
+    /// Each node is drawn as it appears on the canvas, with the transforms of
+    /// its ancestors applied, but not their opacity, masks or filters. It is
+    /// rendered into a scratch buffer of its slot's size and then copied in,
+    /// so it never paints into a neighbour's slot.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - ids: Element IDs to render; duplicates share one slot
+    ///   - scale: Scale factor applied to every node (1.0 = native size)
+    ///   - padding: Transparent pixels between slots (default: 1)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    /// - Returns: The atlas image and the region of each ID within it
+    /// - Throws: `ResvgError.nodeNotFound` if an ID is unknown or renders nothing,
+    ///   `ResvgError.invalidSize` for empty `ids`, a non-positive scale or
+    ///   negative padding
+    public func rasterizeAtlas(
+        tree: SvgTree,
+        ids: [String],
+        scale: Double = 1.0,
+        padding: Int = 1,
+        pixelFormat: PixelFormat = .straightRGBA
+    ) throws -> SpriteAtlas {
+        guard !ids.isEmpty, scale > 0, padding >= 0 else {
+            throw ResvgError.invalidSize
+        }
+
+        return try withExtendedLifetime(tree) {
+            var uniqueIDs: [String] = []
+            var sizes: [(width: Int, height: Int)] = []
+            var seen = Set<String>()
+            for id in ids where seen.insert(id).inserted {
+                var box = resvg_rect()
+                guard resvg_get_node_layer_bbox(tree.ptr, id, &box) else {
+                    throw ResvgError.nodeNotFound(id: id)
+                }
+                uniqueIDs.append(id)
+                sizes.append((
+                    width: max(1, Int((Double(box.width) * scale).rounded(.up))),
+                    height: max(1, Int((Double(box.height) * scale).rounded(.up)))
+                ))
+            }
+
+            let (width, height, slots) = Self.packShelves(sizes, padding: padding)
+            let byteCount = width * height * PixelFormat.bytesPerPixel
+
+            let largestSlot = slots.map { $0.width * $0.height }.max() ?? 0
+            var scratch = [UInt8](repeating: 0, count: largestSlot * PixelFormat.bytesPerPixel)
+
+            let pixmap = [UInt8](unsafeUninitializedCapacity: byteCount) { buffer, initializedCount in
+                guard let base = buffer.baseAddress else { return }
+                base.initialize(repeating: 0, count: byteCount)
+                scratch.withUnsafeMutableBufferPointer { scratch in
+                    guard let scratchBase = scratch.baseAddress else { return }
+                    for (id, slot) in zip(uniqueIDs, slots) {
+                        let rowBytes = slot.width * PixelFormat.bytesPerPixel
+                        scratchBase.update(repeating: 0, count: rowBytes * slot.height)
+                        // The node's layer box is moved to the origin before this is applied.
+                        let transform = resvg_transform(a: Float(scale), b: 0, c: 0, d: Float(scale), e: 0, f: 0)
+                        resvg_render_node_in_place(
+                            tree.ptr,
+                            id,
+                            transform,
+                            UInt32(slot.width),
+                            UInt32(slot.height),
+                            UnsafeMutableRawPointer(scratchBase).assumingMemoryBound(to: CChar.self)
+                        )
+                        for row in 0 ..< slot.height {
+                            let destination = ((slot.y + row) * width + slot.x) * PixelFormat.bytesPerPixel
+                            (base + destination).update(from: scratchBase + row * rowBytes, count: rowBytes)
+                        }
+                    }
+                }
+                pixelFormat.convertFromPremultipliedRGBA(UnsafeMutableRawBufferPointer(start: base, count: byteCount))
+                initializedCount = byteCount
+            }
+
+            return SpriteAtlas(
+                image: RasterizedSvg(width: width, height: height, rgba: pixmap, pixelFormat: pixelFormat),
+                regions: Dictionary(uniqueKeysWithValues: zip(uniqueIDs, slots))
+            )
+        }
+    }
+
+    /// Packs rectangles onto shelves, tallest first.
+    ///
+    /// The atlas is about as wide as it is tall, and never narrower than the
+    /// widest rectangle. Slots are returned in input order.
+    static func packShelves(
+        _ sizes: [(width: Int, height: Int)],
+        padding: Int
+    ) -> (width: Int, height: Int, slots: [PixelRegion]) {
+        let area = sizes.reduce(0) { $0 + ($1.width + padding) * ($1.height + padding) }
+        let widest = sizes.map(\.width).max() ?? 0
+        let targetWidth = max(widest, Int(Double(area).squareRoot().rounded(.up)))
+
+        let order = sizes.indices.sorted {
+            sizes[$0].height != sizes[$1].height ? sizes[$0].height > sizes[$1].height : $0 < $1
+        }
+
+        var slots = [PixelRegion](repeating: PixelRegion(x: 0, y: 0, width: 0, height: 0), count: sizes.count)
+        var x = 0
+        var y = 0
+        var shelfHeight = 0
+        var width = 0
+        for index in order {
+            let size = sizes[index]
+            if x > 0, x + size.width > targetWidth {
+                y += shelfHeight + padding
+                x = 0
+                shelfHeight = 0
+            }
+            slots[index] = PixelRegion(x: x, y: y, width: size.width, height: size.height)
+            width = max(width, x + size.width)
+            shelfHeight = max(shelfHeight, size.height)
+            x += size.width + padding
+        }
+        return (width, y + shelfHeight, slots)
+    }
+}
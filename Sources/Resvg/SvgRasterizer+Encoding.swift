@@ -0,0 +1,102 @@
+import CResvg
+import Foundation
+
+// MARK: - ImageEncoding
+
+/// File format produced by the encoding entry points of `SvgRasterizer`.
+public enum ImageEncoding: Sendable, Hashable {
+    /// PNG, 8-bit straight RGBA.
+    case png(compression: PNGCompression = .default)
+
+    /// QOI (Quite OK Image format), 8-bit straight RGBA. Encodes much faster than PNG.
+    case qoi
+}
+
+/// PNG compression effort.
+public enum PNGCompression: UInt32, Sendable {
+    /// Fastest encoding, larger files.
+    case fast = 0
+
+    /// Balanced speed and size.
+    case `default` = 1
+
+    /// Smallest files, slowest encoding.
+    case best = 2
+}
+
+// MARK: - Encoded Rendering
+
+extension SvgRasterizer {
+    /// Rasterizes an already parsed SVG tree straight to an encoded image
+    ///
+    /// Rendering, unpremultiplying and encoding all happen on the native side,
+    /// so no pixel buffer is created in Swift. The returned `Data` wraps the
+    /// encoder's output without copying it.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - encoding: Output file format
+    /// - Returns: Encoded image file contents
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(tree: SvgTree, scale: Double = 1.0, encoding: ImageEncoding) throws -> Data {
+        try withExtendedLifetime(tree) {
+            let (width, height) = try Self.pixelSize(tree.ptr, scale: scale)
+
+            let (cEncoding, compression): (resvg_encoding, PNGCompression) = switch encoding {
+            case let .png(compression): (RESVG_ENCODING_PNG, compression)
+            case .qoi: (RESVG_ENCODING_QOI, .default)
+            }
+
+            var len: UInt = 0
+            guard let bytes = resvg_render_encoded(
+                tree.ptr,
+                Self.scaleTransform(scale),
+                UInt32(width),
+                UInt32(height),
+                cEncoding,
+                compression.rawValue,
+                &len
+            ) else {
+                throw ResvgError.encodingFailed
+            }
+            return Data(bytesNoCopy: UnsafeMutableRawPointer(bytes), count: Int(len), deallocator: .custom { pointer, count in
+                resvg_encoded_destroy(pointer.assumingMemoryBound(to: UInt8.self), UInt(count))
+            })
+        }
+    }
+
+    /// Rasterizes SVG data straight to an encoded image
+    /// - Parameters:
+    ///   - data: SVG file data (UTF-8 string or gzip compressed)
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - encoding: Output file format
+    /// - Returns: Encoded image file contents
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(data: Data, scale: Double = 1.0, encoding: ImageEncoding) throws -> Data {
+        let tree = try SvgTree(data: data, context: context)
+        return try rasterize(tree: tree, scale: scale, encoding: encoding)
+    }
+
+    /// Rasterizes an SVG file straight to an encoded image
+    /// - Parameters:
+    ///   - url: Path to SVG file
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - encoding: Output file format
+    /// - Returns: Encoded image file contents
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(file url: URL, scale: Double = 1.0, encoding: ImageEncoding) throws -> Data {
+        let data = try SvgFileLoader.load(url)
+        return try rasterize(data: data, scale: scale, encoding: encoding)
+    }
+
+    /// Rasterizes an already parsed SVG tree and writes the encoded image to a file
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - encoding: Output file format
+    ///   - destination: File to create or replace
+    /// - Throws: `ResvgError` on failure, or the error from writing the file
+    public func rasterize(tree: SvgTree, scale: Double = 1.0, encoding: ImageEncoding, to destination: URL) throws {
+        try rasterize(tree: tree, scale: scale, encoding: encoding).write(to: destination, options: .atomic)
+    }
+}
@@ -0,0 +1,214 @@
+import CResvg
+import Foundation
+
+// MARK: - PixelRegion
+
+/// A rectangle in output pixel coordinates (origin at the top-left).
+public struct PixelRegion: Sendable, Hashable {
+    public var x: Int
+    public var y: Int
+    public var width: Int
+    public var height: Int
+
+    public init(x: Int, y: Int, width: Int, height: Int) {
+        self.x = x
+        self.y = y
+        self.width = width
+        self.height = height
+    }
+
+    /// Whether the region is non-empty and lies within a `width` x `height` image.
+    func isContained(inWidth imageWidth: Int, height imageHeight: Int) -> Bool {
+        width > 0 && height > 0
+            && x >= 0 && y >= 0
+            && x <= imageWidth - width && y <= imageHeight - height
+    }
+}
+
+// MARK: - Region Rendering
+
+extension SvgRasterizer {
+    /// Rasterizes one rectangle of the scaled image
+    ///
+    /// Only the region is allocated and rendered, so memory is bounded by the
+    /// region size rather than the full image. Pixels match the same rectangle
+    /// cut from a full render at the same scale (up to anti-aliasing rounding).
+    /// resvg clamps filter regions to the canvas being rendered, which here is
+    /// the region, so a blur or shadow that reaches across the region's edge
+    /// is cut off there.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - region: Rectangle within `outputSize(of:scale:)`
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    /// - Returns: Rasterized region with the region's width and height
+    /// - Throws: `ResvgError.regionOutOfBounds` or another `ResvgError` on failure
+    public func rasterize(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        region: PixelRegion,
+        pixelFormat: PixelFormat = .straightRGBA
+    ) throws -> RasterizedSvg {
+        try withExtendedLifetime(tree) {
+            try Self.validate(region: region, of: tree.ptr, scale: scale)
+            let byteCount = region.width * region.height * PixelFormat.bytesPerPixel
+
+            let pixmap = [UInt8](unsafeUninitializedCapacity: byteCount) { buffer, initializedCount in
+                Self.render(
+                    tree.ptr,
+                    transform: Self.regionTransform(scale, region),
+                    width: region.width,
+                    height: region.height,
+                    into: UnsafeMutableRawPointer(buffer.baseAddress!),
+                    bytesPerRow: region.width * PixelFormat.bytesPerPixel,
+                    pixelFormat: pixelFormat
+                )
+                initializedCount = byteCount
+            }
+
+            return RasterizedSvg(width: region.width, height: region.height, rgba: pixmap, pixelFormat: pixelFormat)
+        }
+    }
+
+    /// Rasterizes one rectangle of the scaled image into caller-provided memory
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - region: Rectangle within `outputSize(of:scale:)`
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - buffer: Destination memory, at least `bytesPerRow * region.height` bytes
+    ///   - bytesPerRow: Row stride in bytes, a multiple of 4 and at least
+    ///     `region.width * 4` (default: `region.width * 4`)
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        region: PixelRegion,
+        pixelFormat: PixelFormat = .straightRGBA,
+        into buffer: UnsafeMutableRawBufferPointer,
+        bytesPerRow: Int? = nil
+    ) throws {
+        try withExtendedLifetime(tree) {
+            try Self.validate(region: region, of: tree.ptr, scale: scale)
+            let stride = bytesPerRow ?? region.width * PixelFormat.bytesPerPixel
+            try Self.validate(buffer: buffer, width: region.width, height: region.height, bytesPerRow: stride)
+            Self.render(
+                tree.ptr,
+                transform: Self.regionTransform(scale, region),
+                width: region.width,
+                height: region.height,
+                into: buffer.baseAddress!,
+                bytesPerRow: stride,
+                pixelFormat: pixelFormat
+            )
+        }
+    }
+
+    /// Rasterizes one rectangle of the scaled image into a reusable pixel buffer
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - region: Rectangle within `outputSize(of:scale:)`
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - buffer: Destination buffer; its dimensions are updated to the region size
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        region: PixelRegion,
+        pixelFormat: PixelFormat = .straightRGBA,
+        into buffer: PixelBuffer
+    ) throws {
+        try withExtendedLifetime(tree) {
+            try Self.validate(region: region, of: tree.ptr, scale: scale)
+        }
+        buffer.prepare(width: region.width, height: region.height, pixelFormat: pixelFormat)
+        try buffer.withUnsafeMutableBytes { bytes in
+            try rasterize(tree: tree, scale: scale, region: region, pixelFormat: pixelFormat, into: bytes)
+        }
+    }
+
+    /// Splits the scaled image into a grid of tiles
+    ///
+    /// Tiles are ordered row by row. Tiles in the last row and column are
+    /// clipped to the image, so they may be smaller than `tileSize`.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - tileSize: Edge length of a tile in pixels
+    /// - Returns: Regions covering the image exactly once
+    /// - Throws: `ResvgError.invalidSize` if `tileSize` is not positive
+    public func tiles(of tree: SvgTree, scale: Double = 1.0, tileSize: Int) throws -> [PixelRegion] {
+        guard tileSize > 0 else {
+            throw ResvgError.invalidSize
+        }
+        let (width, height) = try outputSize(of: tree, scale: scale)
+
+        var regions: [PixelRegion] = []
+        regions.reserveCapacity(((width - 1) / tileSize + 1) * ((height - 1) / tileSize + 1))
+        for y in stride(from: 0, to: height, by: tileSize) {
+            for x in stride(from: 0, to: width, by: tileSize) {
+                regions.append(PixelRegion(
+                    x: x,
+                    y: y,
+                    width: min(tileSize, width - x),
+                    height: min(tileSize, height - y)
+                ))
+            }
+        }
+        return regions
+    }
+
+    /// Rasterizes the scaled image tile by tile
+    ///
+    /// Tiles are rendered one at a time into a single reused buffer, so peak
+    /// memory is one tile regardless of the image size. To render in parallel,
+    /// split the work with `tiles(of:scale:tileSize:)` and call
+    /// `rasterize(tree:scale:region:pixelFormat:)` from several tasks; a tree
+    /// can be shared between them. As with regions, filter effects that cross
+    /// a tile seam are cut off at it, so large blurs can show seams.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - tileSize: Edge length of a tile in pixels
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - body: Receives each tile's region and pixels; the buffer is
+    ///     overwritten by the next tile, so copy out anything you keep
+    /// - Throws: `ResvgError` on failure, or any error thrown by `body`
+    public func rasterizeTiles(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        tileSize: Int,
+        pixelFormat: PixelFormat = .straightRGBA,
+        _ body: (PixelRegion, PixelBuffer) throws -> Void
+    ) throws {
+        // Validates tileSize, and sizes the buffer by the largest tile that
+        // actually fits, so a huge tileSize cannot overflow the capacity.
+        let regions = try tiles(of: tree, scale: scale, tileSize: tileSize)
+        let largestTile = regions.map { $0.width * $0.height }.max() ?? 0
+        let buffer = PixelBuffer(capacity: largestTile * PixelFormat.bytesPerPixel)
+        for region in regions {
+            try rasterize(tree: tree, scale: scale, region: region, pixelFormat: pixelFormat, into: buffer)
+            try body(region, buffer)
+        }
+    }
+
+    static func validate(region: PixelRegion, of tree: OpaquePointer, scale: Double) throws {
+        let (width, height) = try pixelSize(tree, scale: scale)
+        guard region.isContained(inWidth: width, height: height) else {
+            throw ResvgError.regionOutOfBounds(region)
+        }
+    }
+
+    /// Transform for scaling, then shifting the region's origin to (0, 0)
+    static func regionTransform(_ scale: Double, _ region: PixelRegion) -> resvg_transform {
+        resvg_transform(
+            a: Float(scale),
+            b: 0,
+            c: 0,
+            d: Float(scale),
+            e: -Float(region.x),
+            f: -Float(region.y)
+        )
+    }
+}
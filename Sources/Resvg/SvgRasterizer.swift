@@ -5,15 +5,21 @@ import Foundation
 public struct RasterizedSvg: Sendable {
     public let width: Int
     public let height: Int
+
+    /// Pixel data laid out as described by `pixelFormat`
     public let rgba: [UInt8]
 
+    /// Layout of `rgba` (straight RGBA unless requested otherwise)
+    public let pixelFormat: PixelFormat
+
     /// Total number of bytes (should equal width * height * 4)
     public var byteCount: Int { rgba.count }
 
-    public init(width: Int, height: Int, rgba: [UInt8]) {
+    public init(width: Int, height: Int, rgba: [UInt8], pixelFormat: PixelFormat = .straightRGBA) {
         self.width = width
         self.height = height
         self.rgba = rgba
+        self.pixelFormat = pixelFormat
     }
 }
 
@@ -22,56 +28,270 @@ public struct RasterizedSvg: Sendable {
 /// Uses the resvg library (Rust-based, high-quality SVG renderer) via C bindings.
 /// Supports all standard SVG features and produces identical results across platforms.
 public struct SvgRasterizer: Sendable {
-    public init() {}
+    /// The context providing parsing options and fonts.
+    public let context: RenderContext
+
+    /// Cache consulted by the `data:` and `file:` entry points, if any.
+    public let cache: RenderCache?
+
+    /// Receives per-phase timings after each single-image `file:`, `data:`
+    /// and `tree:` rasterization (default: none).
+    ///
+    /// Without a handler nothing is timed, so the hook costs nothing when
+    /// unused. With one, phases are also emitted as `os_signpost` intervals
+    /// on Apple platforms. The handler runs synchronously on the calling thread.
+    public var metricsHandler: (@Sendable (RenderMetrics) -> Void)?
+
+    /// Creates a rasterizer.
+    ///
+    /// - Parameters:
+    ///   - context: Shared parsing options and fonts (default: `RenderContext.default`)
+    ///   - cache: Cache of rendered images keyed by SVG bytes (default: none)
+    public init(context: RenderContext = .default, cache: RenderCache? = nil) {
+        self.context = context
+        self.cache = cache
+    }
+
+    /// Creates a rasterizer with default options at the given quality.
+    ///
+    /// - Parameters:
+    ///   - quality: Speed/quality trade-off, e.g. `.preview` for thumbnails
+    ///   - cache: Cache of rendered images keyed by SVG bytes (default: none)
+    public init(quality: RenderQuality, cache: RenderCache? = nil) {
+        self.init(context: .preset(quality), cache: cache)
+    }
+
+    /// Speed/quality trade-off of the context.
+    ///
+    /// Applies to documents parsed by this rasterizer. A tree passed to the
+    /// `tree:` entry points renders with the quality of the context it was parsed with.
+    public var quality: RenderQuality {
+        context.options.quality
+    }
 
     /// Rasterizes an SVG file to RGBA pixel data
     /// - Parameters:
     ///   - url: Path to SVG file
     ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
     /// - Returns: Rasterized image with width, height, and RGBA bytes
     /// - Throws: `ResvgError` on failure
-    public func rasterize(file url: URL, scale: Double = 1.0) throws -> RasterizedSvg {
-        let data = try Data(contentsOf: url)
-        return try rasterize(data: data, scale: scale)
+    public func rasterize(
+        file url: URL,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA
+    ) throws -> RasterizedSvg {
+        let recorder = makeRecorder()
+        recorder?.begin(.load)
+        let data = try SvgFileLoader.load(url)
+        recorder?.end(.load)
+        let image = try rasterize(data: data, scale: scale, pixelFormat: pixelFormat, recorder: recorder)
+        recorder?.report()
+        return image
     }
 
     /// Rasterizes SVG data to RGBA pixel data
     /// - Parameters:
     ///   - data: SVG file data (UTF-8 string or gzip compressed)
     ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
     /// - Returns: Rasterized image with width, height, and RGBA bytes
     /// - Throws: `ResvgError` on failure
-    public func rasterize(data: Data, scale: Double = 1.0) throws -> RasterizedSvg {
-        // Create options
-        guard let opt = resvg_options_create() else {
-            throw ResvgError.unknownError(code: -1)
+    public func rasterize(
+        data: Data,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA
+    ) throws -> RasterizedSvg {
+        let recorder = makeRecorder()
+        let image = try rasterize(data: data, scale: scale, pixelFormat: pixelFormat, recorder: recorder)
+        recorder?.report()
+        return image
+    }
+
+    /// Rasterizes an already parsed SVG tree to RGBA pixel data
+    ///
+    /// Parsing is often as expensive as rendering, so reuse one tree when
+    /// producing several outputs from the same document.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    /// - Returns: Rasterized image with width, height, and RGBA bytes
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA
+    ) throws -> RasterizedSvg {
+        let recorder = makeRecorder()
+        let image = try withExtendedLifetime(tree) {
+            try render(tree.ptr, scale: scale, pixelFormat: pixelFormat, recorder: recorder)
         }
-        defer { resvg_options_destroy(opt) }
+        recorder?.report()
+        return image
+    }
 
-        // Parse SVG tree
-        var tree: OpaquePointer?
-        let result = data.withUnsafeBytes { ptr -> Int32 in
-            guard let baseAddress = ptr.baseAddress else {
-                return Int32(RESVG_ERROR_PARSING_FAILED.rawValue)
-            }
-            return resvg_parse_tree_from_data(
-                baseAddress.assumingMemoryBound(to: CChar.self),
-                UInt(ptr.count),
-                opt,
-                &tree
+    /// Rasterizes an already parsed SVG tree at several scales
+    ///
+    /// The document is parsed once, e.g. to produce @1x/@2x/@3x assets.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scales: Scale factors, one output per entry
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    /// - Returns: Rasterized images in the order of `scales`
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(
+        tree: SvgTree,
+        scales: [Double],
+        pixelFormat: PixelFormat = .straightRGBA
+    ) throws -> [RasterizedSvg] {
+        try withExtendedLifetime(tree) {
+            try scales.map { try render(tree.ptr, scale: $0, pixelFormat: pixelFormat) }
+        }
+    }
+
+    /// Output size in pixels for a tree at the given scale
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    /// - Returns: Width and height of the rasterized image
+    /// - Throws: `ResvgError.emptyImage` or `ResvgError.invalidSize`
+    public func outputSize(of tree: SvgTree, scale: Double = 1.0) throws -> (width: Int, height: Int) {
+        try withExtendedLifetime(tree) {
+            try Self.pixelSize(tree.ptr, scale: scale)
+        }
+    }
+
+    /// Rasterizes an already parsed SVG tree into caller-provided memory
+    ///
+    /// No pixel memory is allocated. The rows of the image are written
+    /// `bytesPerRow` apart; padding bytes at the end of each row are zeroed.
+    /// Use `outputSize(of:scale:)` to size the buffer.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - buffer: Destination memory, at least `bytesPerRow * height` bytes
+    ///   - bytesPerRow: Row stride in bytes, a multiple of 4 and at least
+    ///     `width * 4` (default: `width * 4`)
+    /// - Returns: Width and height of the rendered image
+    /// - Throws: `ResvgError` on failure
+    @discardableResult
+    public func rasterize(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA,
+        into buffer: UnsafeMutableRawBufferPointer,
+        bytesPerRow: Int? = nil
+    ) throws -> (width: Int, height: Int) {
+        let recorder = makeRecorder()
+        let size = try withExtendedLifetime(tree) {
+            let (width, height) = try Self.pixelSize(tree.ptr, scale: scale)
+            let stride = bytesPerRow ?? width * PixelFormat.bytesPerPixel
+            try Self.validate(buffer: buffer, width: width, height: height, bytesPerRow: stride)
+            Self.render(
+                tree.ptr,
+                transform: Self.scaleTransform(scale),
+                width: width,
+                height: height,
+                into: buffer.baseAddress!,
+                bytesPerRow: stride,
+                pixelFormat: pixelFormat,
+                recorder: recorder
             )
+            recorder?.recordOutput(width: width, height: height, tree: tree.ptr)
+            return (width: width, height: height)
+        }
+        recorder?.report()
+        return size
+    }
+
+    /// Rasterizes an already parsed SVG tree into a reusable pixel buffer
+    ///
+    /// The buffer grows when needed but never shrinks, so rendering many
+    /// images through one buffer allocates only for the largest of them.
+    /// - Parameters:
+    ///   - tree: Parsed SVG tree
+    ///   - scale: Scale factor for output resolution (1.0 = native size)
+    ///   - pixelFormat: Output pixel layout (default: straight RGBA)
+    ///   - buffer: Destination buffer; its dimensions are updated to match the output
+    /// - Throws: `ResvgError` on failure
+    public func rasterize(
+        tree: SvgTree,
+        scale: Double = 1.0,
+        pixelFormat: PixelFormat = .straightRGBA,
+        into buffer: PixelBuffer
+    ) throws {
+        let (width, height) = try outputSize(of: tree, scale: scale)
+        buffer.prepare(width: width, height: height, pixelFormat: pixelFormat)
+        try buffer.withUnsafeMutableBytes { bytes in
+            _ = try rasterize(tree: tree, scale: scale, pixelFormat: pixelFormat, into: bytes)
         }
+    }
 
-        // Check for parsing errors
-        if let error = ResvgError.fromCode(result) {
-            throw error
+    private func makeRecorder() -> MetricsRecorder? {
+        metricsHandler.map { MetricsRecorder(handler: $0) }
+    }
+
+    private func rasterize(
+        data: Data,
+        scale: Double,
+        pixelFormat: PixelFormat,
+        recorder: MetricsRecorder?
+    ) throws -> RasterizedSvg {
+        let key = cache.map { _ in
+            RenderCache.Key(data: data, context: context, scale: scale, pixelFormat: pixelFormat)
+        }
+        if let cache, let key, let image = cache.image(for: key) {
+            recorder?.recordCacheHit(image)
+            return image
         }
 
-        guard let tree else {
-            throw ResvgError.parsingFailed
+        recorder?.begin(.parse)
+        let tree = try SvgTree(data: data, context: context)
+        recorder?.end(.parse)
+        let image = try withExtendedLifetime(tree) {
+            try render(tree.ptr, scale: scale, pixelFormat: pixelFormat, recorder: recorder)
+        }
+        if let cache, let key {
+            cache.insert(image, for: key)
+        }
+        return image
+    }
+
+    private func render(
+        _ tree: OpaquePointer,
+        scale: Double,
+        pixelFormat: PixelFormat,
+        recorder: MetricsRecorder? = nil
+    ) throws -> RasterizedSvg {
+        let (width, height) = try Self.pixelSize(tree, scale: scale)
+        let byteCount = width * height * PixelFormat.bytesPerPixel
+        recorder?.recordAllocation(bytes: byteCount)
+
+        // Allocate pixmap buffer (cleared by render)
+        let pixmap = [UInt8](unsafeUninitializedCapacity: byteCount) { buffer, initializedCount in
+            Self.render(
+                tree,
+                transform: Self.scaleTransform(scale),
+                width: width,
+                height: height,
+                into: UnsafeMutableRawPointer(buffer.baseAddress!),
+                bytesPerRow: width * PixelFormat.bytesPerPixel,
+                pixelFormat: pixelFormat,
+                recorder: recorder
+            )
+            initializedCount = byteCount
         }
-        defer { resvg_tree_destroy(tree) }
+        recorder?.recordOutput(width: width, height: height, tree: tree)
+
+        return RasterizedSvg(width: width, height: height, rgba: pixmap, pixelFormat: pixelFormat)
+    }
 
+    // MARK: - Rendering Primitives
+
+    /// Scaled output size of a native tree.
+    static func pixelSize(_ tree: OpaquePointer, scale: Double) throws -> (width: Int, height: Int) {
         // Check if image is empty
         if resvg_is_image_empty(tree) {
             throw ResvgError.emptyImage
@@ -85,12 +305,12 @@ public struct SvgRasterizer: Sendable {
         guard width > 0, height > 0 else {
             throw ResvgError.invalidSize
         }
+        return (width, height)
+    }
 
-        // Allocate pixmap buffer
-        var pixmap = [UInt8](repeating: 0, count: width * height * 4)
-
-        // Create transform for scaling
-        let transform = resvg_transform(
+    /// Transform for scaling
+    static func scaleTransform(_ scale: Double) -> resvg_transform {
+        resvg_transform(
             a: Float(scale),
             b: 0,
             c: 0,
@@ -98,41 +318,63 @@ public struct SvgRasterizer: Sendable {
             e: 0,
             f: 0
         )
+    }
 
-        // Render SVG to pixmap
-        pixmap.withUnsafeMutableBytes { ptr in
-            guard let baseAddress = ptr.baseAddress else { return }
-            resvg_render(
-                tree,
-                transform,
-                UInt32(width),
-                UInt32(height),
-                baseAddress.assumingMemoryBound(to: CChar.self)
-            )
+    static func validate(
+        buffer: UnsafeMutableRawBufferPointer,
+        width: Int,
+        height: Int,
+        bytesPerRow: Int
+    ) throws {
+        guard bytesPerRow >= width * PixelFormat.bytesPerPixel,
+              bytesPerRow % PixelFormat.bytesPerPixel == 0
+        else {
+            throw ResvgError.invalidRowStride(bytesPerRow: bytesPerRow)
+        }
+        let required = bytesPerRow * height
+        guard buffer.baseAddress != nil, buffer.count >= required else {
+            throw ResvgError.bufferTooSmall(required: required, actual: buffer.count)
         }
-
-        // Unpremultiply alpha (resvg outputs premultiplied RGBA)
-        unpremultiplyAlpha(&pixmap)
-
-        return RasterizedSvg(width: width, height: height, rgba: pixmap)
     }
 
-    /// Unpremultiplies alpha values to get correct RGB values
+    /// Clears `base`, renders a native tree into it and converts the pixel format.
     ///
-    /// resvg outputs premultiplied RGBA where RGB = RGB * alpha.
-    /// We need straight alpha (RGB independent of alpha) for WebP encoding.
-    private func unpremultiplyAlpha(_ rgba: inout [UInt8]) {
-        let pixelCount = rgba.count / 4
-        for i in 0 ..< pixelCount {
-            let offset = i * 4
-            let alpha = rgba[offset + 3]
-
-            if alpha > 0, alpha < 255 {
-                let alphaFloat = Float(alpha) / 255.0
-                rgba[offset] = UInt8(min(255, Float(rgba[offset]) / alphaFloat))
-                rgba[offset + 1] = UInt8(min(255, Float(rgba[offset + 1]) / alphaFloat))
-                rgba[offset + 2] = UInt8(min(255, Float(rgba[offset + 2]) / alphaFloat))
+    /// resvg needs tightly packed rows, so padded rows are rendered as a wider
+    /// pixmap and the padding is cleared afterwards. No intermediate copy is made.
+    static func render(
+        _ tree: OpaquePointer,
+        transform: resvg_transform,
+        width: Int,
+        height: Int,
+        into base: UnsafeMutableRawPointer,
+        bytesPerRow: Int,
+        pixelFormat: PixelFormat,
+        recorder: MetricsRecorder? = nil
+    ) {
+        let byteCount = bytesPerRow * height
+        let rowBytes = width * PixelFormat.bytesPerPixel
+        recorder?.begin(.render)
+        base.initializeMemory(as: UInt8.self, repeating: 0, count: byteCount)
+
+        // Render SVG to pixmap (premultiplied RGBA)
+        resvg_render(
+            tree,
+            transform,
+            UInt32(bytesPerRow / PixelFormat.bytesPerPixel),
+            UInt32(height),
+            base.assumingMemoryBound(to: CChar.self)
+        )
+
+        if bytesPerRow > rowBytes {
+            for row in 0 ..< height {
+                (base + row * bytesPerRow + rowBytes)
+                    .initializeMemory(as: UInt8.self, repeating: 0, count: bytesPerRow - rowBytes)
             }
         }
+        recorder?.end(.render)
+
+        recorder?.begin(.pixelConversion)
+        pixelFormat.convertFromPremultipliedRGBA(UnsafeMutableRawBufferPointer(start: base, count: byteCount))
+        recorder?.end(.pixelConversion)
     }
 }
@@ -0,0 +1,214 @@
+import CResvg
+import Foundation
+
+// MARK: - RenderCostEstimate
+
+/// The work rendering a tree is expected to take, measured without rendering.
+///
+/// Areas are in output pixels at the scale the estimate was made for. Clip
+/// paths, masks, patterns, text and nested SVG images are included.
+public struct RenderCostEstimate: Sendable, Equatable {
+    /// Groups, including those inside clip paths, masks and patterns.
+    public let groupCount: Int
+
+    /// Paths, including the paths text is rendered as.
+    public let pathCount: Int
+
+    /// Image elements.
+    public let imageCount: Int
+
+    /// Text elements.
+    public let textCount: Int
+
+    /// Path segments across all paths.
+    public let pathSegmentCount: Int
+
+    /// Fills and strokes painted with a gradient.
+    public let gradientCount: Int
+
+    /// Fills and strokes painted with a pattern.
+    public let patternCount: Int
+
+    /// Masks applied to groups.
+    public let maskCount: Int
+
+    /// Clip paths applied to groups.
+    public let clipPathCount: Int
+
+    /// Filters applied to groups.
+    public let filterCount: Int
+
+    /// Groups rendered into an offscreen buffer because of opacity, clipping,
+    /// masking, filters or blending.
+    public let layerCount: Int
+
+    /// Area of the output image.
+    public let outputPixels: Double
+
+    /// Bounding-box area of every fill and stroke.
+    public let paintedPixels: Double
+
+    /// The part of `paintedPixels` painted with gradients or patterns.
+    public let gradientPixels: Double
+
+    /// Area of all offscreen buffers.
+    public let layerPixels: Double
+
+    /// Layer area times the number of filters applied to it.
+    public let filterPixels: Double
+
+    /// Intrinsic pixels of raster images, read from their headers.
+    public let imagePixels: Int
+
+    init(_ cost: resvg_render_cost) {
+        self.groupCount = Int(cost.groups)
+        self.pathCount = Int(cost.paths)
+        self.imageCount = Int(cost.images)
+        self.textCount = Int(cost.texts)
+        self.pathSegmentCount = Int(cost.path_segments)
+        self.gradientCount = Int(cost.gradients)
+        self.patternCount = Int(cost.patterns)
+        self.maskCount = Int(cost.masks)
+        self.clipPathCount = Int(cost.clip_paths)
+        self.filterCount = Int(cost.filters)
+        self.layerCount = Int(cost.layers)
+        self.outputPixels = cost.output_pixels
+        self.paintedPixels = cost.painted_pixels
+        self.gradientPixels = cost.gradient_pixels
+        self.layerPixels = cost.layer_pixels
+        self.filterPixels = cost.filter_pixels
+        self.imagePixels = Int(cost.image_pixels)
+    }
+
+    /// Total node count.
+    public var nodeCount: Int {
+        groupCount + pathCount + imageCount + textCount
+    }
+
+    /// A single cost figure for ordering and admission control.
+    ///
+    /// - Parameter weights: Cost of each unit of work (default: `.default`)
+    /// - Returns: Estimated cost in the units of `weights`
+    public func score(weights: RenderCostWeights = .default) -> Double {
+        weights.perNode * Double(nodeCount)
+            + weights.perPathSegment * Double(pathSegmentCount)
+            + weights.perOutputPixel * outputPixels
+            + weights.perPaintedPixel * paintedPixels
+            + weights.perGradientPixel * gradientPixels
+            + weights.perLayerPixel * layerPixels
+            + weights.perFilterPixel * filterPixels
+            + weights.perImagePixel * Double(imagePixels)
+    }
+}
+
+// MARK: - RenderCostWeights
+
+/// Converts a `RenderCostEstimate` into a score.
+///
+/// The defaults are rough relative costs, chosen so a score is on the order of
+/// nanoseconds of render time. For scores in real time on your hardware, time
+/// renders with `SvgRasterizer.metricsHandler` and pass the results to
+/// `calibrated(to:)`.
+public struct RenderCostWeights: Sendable, Equatable {
+    /// Fixed cost of visiting a node.
+    public var perNode: Double
+
+    /// Flattening and edge setup per path segment.
+    public var perPathSegment: Double
+
+    /// Clearing and pixel conversion per output pixel.
+    public var perOutputPixel: Double
+
+    /// Filling one pixel with a solid color.
+    public var perPaintedPixel: Double
+
+    /// Extra cost of shading one pixel with a gradient or pattern.
+    public var perGradientPixel: Double
+
+    /// Allocating and compositing one layer pixel.
+    public var perLayerPixel: Double
+
+    /// Running one filter over one pixel.
+    public var perFilterPixel: Double
+
+    /// Decoding and sampling one image pixel.
+    public var perImagePixel: Double
+
+    /// Rough relative costs of resvg's CPU renderer.
+    public static let `default` = RenderCostWeights(
+        perNode: 200,
+        perPathSegment: 40,
+        perOutputPixel: 0.5,
+        perPaintedPixel: 1,
+        perGradientPixel: 3,
+        perLayerPixel: 2,
+        perFilterPixel: 15,
+        perImagePixel: 4
+    )
+
+    public init(
+        perNode: Double,
+        perPathSegment: Double,
+        perOutputPixel: Double,
+        perPaintedPixel: Double,
+        perGradientPixel: Double,
+        perLayerPixel: Double,
+        perFilterPixel: Double,
+        perImagePixel: Double
+    ) {
+        self.perNode = perNode
+        self.perPathSegment = perPathSegment
+        self.perOutputPixel = perOutputPixel
+        self.perPaintedPixel = perPaintedPixel
+        self.perGradientPixel = perGradientPixel
+        self.perLayerPixel = perLayerPixel
+        self.perFilterPixel = perFilterPixel
+        self.perImagePixel = perImagePixel
+    }
+
+    /// These weights scaled so the scores of `samples` add up to their measured time.
+    ///
+    /// - Parameter samples: Estimates paired with the render time measured
+    ///   for them, in nanoseconds
+    /// - Returns: Scaled weights, or these weights if the samples are empty
+    public func calibrated(to samples: [(estimate: RenderCostEstimate, nanoseconds: UInt64)]) -> RenderCostWeights {
+        let predicted = samples.reduce(0) { $0 + $1.estimate.score(weights: self) }
+        let measured = samples.reduce(0) { $0 + Double($1.nanoseconds) }
+        guard predicted > 0, measured > 0 else {
+            return self
+        }
+        let factor = measured / predicted
+        return RenderCostWeights(
+            perNode: perNode * factor,
+            perPathSegment: perPathSegment * factor,
+            perOutputPixel: perOutputPixel * factor,
+            perPaintedPixel: perPaintedPixel * factor,
+            perGradientPixel: perGradientPixel * factor,
+            perLayerPixel: perLayerPixel * factor,
+            perFilterPixel: perFilterPixel * factor,
+            perImagePixel: perImagePixel * factor
+        )
+    }
+}
+
+// MARK: - Cost Estimation
+
+extension SvgTree {
+    /// Estimates the cost of rendering the tree at `scale`.
+    ///
+    /// Computed natively in one traversal; nothing is rendered or decoded,
+    /// so it is cheap enough to run before admitting or scheduling a render.
+    /// - Parameter scale: Scale factor the tree will be rendered at (1.0 = native size)
+    /// - Returns: The estimate
+    /// - Throws: `ResvgError.invalidSize` if `scale` is not positive
+    public func costEstimate(scale: Double = 1.0) throws -> RenderCostEstimate {
+        var cost = resvg_render_cost()
+        let succeeded = withExtendedLifetime(self) {
+            resvg_tree_render_cost(ptr, Float(scale), &cost)
+        }
+        guard succeeded else {
+            throw ResvgError.invalidSize
+        }
+        return RenderCostEstimate(cost)
+    }
+}
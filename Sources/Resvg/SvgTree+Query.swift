@@ -0,0 +1,99 @@
+import CResvg
+import Foundation
+
+// MARK: - Queries
+
+extension SvgTree {
+    /// The node with the given element ID, or nil if there is none.
+    ///
+    /// The first call builds a hash index over all IDs in one native traversal;
+    /// later lookups are O(1). If several nodes share an ID, the first in
+    /// document order is returned.
+    public func node(withID id: String) -> TreeNode? {
+        idIndex.pointer(for: id, in: self).map { TreeNode($0, tree: self) }
+    }
+
+    /// All nodes of the given type below the root, in document order.
+    ///
+    /// Collected in a single native traversal. The root group is not included.
+    public func nodes(ofType type: NodeType) -> [TreeNode] {
+        collectNodes(typeMask: 1 << type.rawValue).map { TreeNode($0, tree: self) }
+    }
+
+    /// All nodes below the root that match `predicate`, in document order.
+    ///
+    /// The tree is collected in a single native traversal and `predicate` runs
+    /// over the result. The root group is not included.
+    /// - Parameters:
+    ///   - type: Only consider nodes of this type (default: all types)
+    ///   - predicate: Returns true for nodes to include
+    public func nodes(
+        ofType type: NodeType? = nil,
+        where predicate: (TreeNode) throws -> Bool
+    ) rethrows -> [TreeNode] {
+        let typeMask = type.map { UInt32(1) << $0.rawValue } ?? Self.allNodeTypes
+        var result: [TreeNode] = []
+        for pointer in collectNodes(typeMask: typeMask) {
+            let node = TreeNode(pointer, tree: self)
+            if try predicate(node) {
+                result.append(node)
+            }
+        }
+        return result
+    }
+
+    /// Type mask selecting every node type.
+    static let allNodeTypes: UInt32 = 0b1111
+
+    /// Node pointers selected by `typeMask` (bit `1 << NodeType.rawValue`), in preorder.
+    func collectNodes(typeMask: UInt32) -> [UnsafeRawPointer] {
+        withNodeList(typeMask: typeMask) { _, items in items }
+    }
+
+    /// Collects the nodes selected by `typeMask` and passes the native list
+    /// and its node pointers to `body`. The list is freed afterwards.
+    func withNodeList<T>(
+        typeMask: UInt32,
+        _ body: (OpaquePointer?, [UnsafeRawPointer]) throws -> T
+    ) rethrows -> T {
+        let list = resvg_tree_collect_nodes(ptr, typeMask)
+        defer { resvg_node_list_destroy(list) }
+
+        var count: UInt = 0
+        guard let items = resvg_node_list_items(list, &count) else {
+            return try body(list, [])
+        }
+        let pointers = UnsafeBufferPointer(start: items, count: Int(count)).compactMap { $0.map(UnsafeRawPointer.init) }
+        return try body(list, pointers)
+    }
+}
+
+// MARK: - NodeIDIndex
+
+/// Maps element IDs to node pointers of one tree.
+///
+/// Built lazily and at most once; safe to use from several threads.
+final class NodeIDIndex: @unchecked Sendable {
+    private let lock = NSLock()
+    private var pointers: [String: UnsafeRawPointer]?
+
+    func pointer(for id: String, in tree: SvgTree) -> UnsafeRawPointer? {
+        lock.withLock {
+            if pointers == nil {
+                pointers = Self.build(tree)
+            }
+            return pointers?[id]
+        }
+    }
+
+    private static func build(_ tree: SvgTree) -> [String: UnsafeRawPointer] {
+        var pointers: [String: UnsafeRawPointer] = [:]
+        for node in tree.collectNodes(typeMask: SvgTree.allNodeTypes) {
+            let id = NativeString.decode { resvg_node_id(OpaquePointer(node), $0) }
+            if !id.isEmpty, pointers[id] == nil {
+                pointers[id] = node
+            }
+        }
+        return pointers
+    }
+}
@@ -0,0 +1,133 @@
+import CResvg
+import Foundation
+
+// MARK: - Resolved Document
+
+/// Versioned container for a tree written back out as resolved SVG.
+///
+/// Layout (little-endian):
+/// - 8 bytes: magic `RSVGRDOC`
+/// - 4 bytes: format version
+/// - 4 bytes: flags, reserved (0)
+/// - 8 bytes: payload length
+/// - payload: the tree as resolved SVG text
+///
+/// The payload is SVG as usvg produced it, not a binary tree: usvg has no way
+/// to load a tree other than parsing. CSS is applied, `<use>` expanded,
+/// text converted to paths and images embedded, so loading still runs the XML
+/// and usvg parsers but skips style resolution, text shaping and font and
+/// image loading.
+enum ResolvedDocument {
+    static let magic: [UInt8] = Array("RSVGRDOC".utf8)
+    static let version: UInt32 = 1
+    static let headerSize = 24
+
+    /// Writer settings that keep the payload compact and independent of fonts.
+    static let writeOptions = SvgWriteOptions(indent: .none, preservesText: false)
+
+    static func header(payloadLength: Int) -> Data {
+        var header = Data(magic)
+        withUnsafeBytes(of: version.littleEndian) { header.append(contentsOf: $0) }
+        withUnsafeBytes(of: UInt32(0).littleEndian) { header.append(contentsOf: $0) }
+        withUnsafeBytes(of: UInt64(payloadLength).littleEndian) { header.append(contentsOf: $0) }
+        return header
+    }
+
+    /// Validates the header and returns the payload without copying it.
+    ///
+    /// - Throws: `ResvgError.invalidResolvedDocument` for foreign, truncated or
+    ///   newer-version data
+    static func payload(of data: Data) throws -> Data {
+        guard data.count >= headerSize, data.prefix(magic.count).elementsEqual(magic) else {
+            throw ResvgError.invalidResolvedDocument
+        }
+        let start = data.startIndex
+        let version = readLittleEndian(UInt32.self, data, at: start + 8)
+        let length = readLittleEndian(UInt64.self, data, at: start + 16)
+        guard version == Self.version, length <= UInt64(data.count - headerSize) else {
+            throw ResvgError.invalidResolvedDocument
+        }
+        return data[start + headerSize ..< start + headerSize + Int(length)]
+    }
+
+    private static func readLittleEndian<T: FixedWidthInteger>(_: T.Type, _ data: Data, at offset: Int) -> T {
+        var value = T.zero
+        withUnsafeMutableBytes(of: &value) { $0.copyBytes(from: data[offset ..< offset + MemoryLayout<T>.size]) }
+        return T(littleEndian: value)
+    }
+}
+
+extension SvgTree {
+    /// Writes the tree as a resolved document, a cache for `init(resolvedDocument:)`.
+    ///
+    /// The document is versioned, normalized SVG. Loading it is a full parse
+    /// of that SVG, but without CSS resolution, `<use>` expansion, text
+    /// layout or font and image loading. It pays off for documents where
+    /// those dominate, such as text-heavy or style-heavy templates.
+    ///
+    /// Lossy: text becomes paths, so it is no longer selectable as text, and
+    /// linked images are embedded.
+    /// - Returns: The resolved document
+    /// - Throws: `ResvgError.svgExportFailed` on failure
+    public func resolvedDocument() throws -> Data {
+        var payload = Data()
+        try SvgWriter.write(ptr, options: ResolvedDocument.writeOptions, chunkSize: 0) { chunk in
+            payload.append(contentsOf: chunk)
+        }
+        return ResolvedDocument.header(payloadLength: payload.count) + payload
+    }
+
+    /// Writes the tree as a resolved document to a file.
+    ///
+    /// The payload is streamed to the file in chunks.
+    /// - Parameter url: Destination file; replaced if it exists
+    /// - Throws: `ResvgError` on export failure, or the write error
+    public func writeResolvedDocument(to url: URL) throws {
+        guard FileManager.default.createFile(atPath: url.path, contents: nil) else {
+            throw ResvgError.fileOpenFailed(path: url.path)
+        }
+        let handle = try FileHandle(forWritingTo: url)
+        defer { try? handle.close() }
+
+        try handle.write(contentsOf: ResolvedDocument.header(payloadLength: 0))
+        var length = 0
+        try SvgWriter.write(ptr, options: ResolvedDocument.writeOptions, chunkSize: 64 * 1024) { chunk in
+            try handle.write(contentsOf: chunk)
+            length += chunk.count
+        }
+        try handle.seek(toOffset: 0)
+        try handle.write(contentsOf: ResolvedDocument.header(payloadLength: length))
+    }
+
+    /// Parses a document produced by `resolvedDocument()`.
+    ///
+    /// - Parameters:
+    ///   - data: Resolved document
+    ///   - context: Parsing options (default: `RenderContext.default`). Styles
+    ///     are already applied, so use a context without a `stylesheet`.
+    /// - Throws: `ResvgError.invalidResolvedDocument` for foreign or
+    ///   incompatible data, or another `ResvgError` on parsing failure
+    public convenience init(resolvedDocument data: Data, context: RenderContext = .default) throws {
+        try self.init(data: ResolvedDocument.payload(of: data), context: context)
+    }
+
+    /// Parses a document file written by `writeResolvedDocument(to:)`.
+    ///
+    /// The file is memory-mapped rather than copied onto the heap, then
+    /// parsed like `init(resolvedDocument:)`.
+    /// - Parameters:
+    ///   - url: Resolved document file
+    ///   - context: Parsing options (default: `RenderContext.default`). Styles
+    ///     are already applied, so use a context without a `stylesheet`.
+    /// - Throws: `ResvgError.fileOpenFailed`, `ResvgError.invalidResolvedDocument`
+    ///   or another `ResvgError` on parsing failure
+    public convenience init(resolvedDocumentAt url: URL, context: RenderContext = .default) throws {
+        let data: Data
+        do {
+            data = try Data(contentsOf: url, options: .alwaysMapped)
+        } catch {
+            throw ResvgError.fileOpenFailed(path: url.path)
+        }
+        try self.init(resolvedDocument: data, context: context)
+    }
+}
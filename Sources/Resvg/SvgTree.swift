@@ -26,47 +26,38 @@ import Foundation
 public final class SvgTree: @unchecked Sendable {
     let ptr: OpaquePointer
 
+    /// The context the tree was parsed with.
+    public let context: RenderContext
+
+    /// ID lookup table, built on first use by `node(withID:)`.
+    let idIndex = NodeIDIndex()
+
     /// Parses SVG data into a tree.
     ///
-    /// - Parameter data: Raw SVG data (UTF-8 or gzip compressed)
+    /// - Parameters:
+    ///   - data: Raw SVG data (UTF-8 or gzip compressed)
+    ///   - context: Shared parsing options and fonts (default: `RenderContext.default`)
     /// - Throws: `ResvgError` on parsing failure
-    public init(data: Data) throws {
-        guard let opt = resvg_options_create() else {
-            throw ResvgError.unknownError(code: -1)
-        }
-        defer { resvg_options_destroy(opt) }
-
-        var tree: OpaquePointer?
-        let result = data.withUnsafeBytes { ptr -> Int32 in
-            guard let baseAddress = ptr.baseAddress else {
-                return Int32(RESVG_ERROR_PARSING_FAILED.rawValue)
-            }
-            return resvg_parse_tree_from_data(
-                baseAddress.assumingMemoryBound(to: CChar.self),
-                UInt(ptr.count),
-                opt,
-                &tree
-            )
-        }
-
-        if let error = ResvgError.fromCode(result) {
-            throw error
-        }
-
-        guard let tree else {
-            throw ResvgError.parsingFailed
-        }
+    public init(data: Data, context: RenderContext = .default) throws {
+        self.ptr = try context.parseTree(data)
+        self.context = context
+    }
 
-        self.ptr = tree
+    /// Takes ownership of a tree built natively, e.g. a recolored copy.
+    init(ptr: OpaquePointer, context: RenderContext) {
+        self.ptr = ptr
+        self.context = context
     }
 
     /// Parses SVG from a file.
     ///
-    /// - Parameter url: Path to SVG file
+    /// - Parameters:
+    ///   - url: Path to SVG file
+    ///   - context: Shared parsing options and fonts (default: `RenderContext.default`)
     /// - Throws: `ResvgError` on parsing failure
-    public convenience init(file url: URL) throws {
-        let data = try Data(contentsOf: url)
-        try self.init(data: data)
+    public convenience init(file url: URL, context: RenderContext = .default) throws {
+        let data = try SvgFileLoader.load(url)
+        try self.init(data: data, context: context)
     }
 
     deinit {
@@ -152,7 +143,7 @@ public struct Transform: Sendable, Equatable {
 // MARK: - Color
 
 /// An RGBA color.
-public struct Color: Sendable, Equatable {
+public struct Color: Sendable, Hashable {
     public let r: UInt8
     public let g: UInt8
     public let b: UInt8
@@ -18,11 +18,12 @@ public struct TextNode: @unchecked Sendable {
 
     /// The element ID (from `id` attribute), or empty string if none.
     public var id: String {
-        var len: UInt = 0
-        guard let idPtr = resvg_text_id(ptr, &len), len > 0 else {
-            return ""
-        }
-        return String(cString: idPtr)
+        NativeString.decode { resvg_text_id(ptr, $0) }
+    }
+
+    /// Whether the element ID equals `id`, compared without allocating.
+    public func hasID(_ id: String) -> Bool {
+        NativeString.equals(id) { resvg_text_id(ptr, $0) }
     }
 
     /// The relative transform of this text element.
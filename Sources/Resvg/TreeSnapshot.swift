@@ -0,0 +1,201 @@
+import CResvg
+import Foundation
+
+// MARK: - TreeSnapshot
+
+/// A flat, read-only copy of an SVG tree.
+///
+/// The whole tree is copied in one native call into contiguous node, paint and
+/// string tables, so walking it needs no further calls into resvg. Prefer it
+/// over `Group.children` and the per-node getters for large documents.
+///
+/// Nodes are in preorder and the root group is at index 0. A snapshot does not
+/// reference its tree and stays valid after the tree is released.
+///
+/// Example usage:
+/// ```swift
+/// let snapshot = try SvgTree(data: svgData).snapshot()
+/// for index in snapshot.children(of: TreeSnapshot.rootIndex) {
+///     let node = snapshot.nodes[index]
+///     print(node.kind, snapshot.id(of: index), node.boundingBox)
+/// }
+/// ```
+public struct TreeSnapshot: Sendable {
+    /// Index of the root group.
+    public static let rootIndex = 0
+
+    /// All nodes in preorder.
+    public let nodes: [SnapshotNode]
+
+    /// Fills and strokes referenced by `SnapshotNode.fillIndex` and `strokeIndex`.
+    public let paints: [SnapshotPaint]
+
+    /// UTF-8 IDs of all nodes, concatenated.
+    public let strings: [UInt8]
+
+    init(_ tree: OpaquePointer) {
+        let snapshot = resvg_tree_snapshot_create(tree)!
+        defer { resvg_tree_snapshot_destroy(snapshot) }
+
+        var nodeCount: UInt = 0
+        var paintCount: UInt = 0
+        var stringCount: UInt = 0
+        let nodes = resvg_tree_snapshot_nodes(snapshot, &nodeCount)
+        let paints = resvg_tree_snapshot_paints(snapshot, &paintCount)
+        let strings = resvg_tree_snapshot_strings(snapshot, &stringCount)
+
+        self.nodes = UnsafeBufferPointer(start: nodes, count: Int(nodeCount)).map(SnapshotNode.init)
+        self.paints = UnsafeBufferPointer(start: paints, count: Int(paintCount)).map(SnapshotPaint.init)
+        self.strings = Array(UnsafeBufferPointer(start: strings, count: Int(stringCount)))
+    }
+
+    /// The element ID of a node, or empty string if none.
+    public func id(of index: Int) -> String {
+        let node = nodes[index]
+        guard node.idLength > 0 else { return "" }
+        let start = Int(node.idOffset)
+        return String(decoding: strings[start ..< start + Int(node.idLength)], as: UTF8.self)
+    }
+
+    /// The direct children of a node, in document order.
+    public func children(of index: Int) -> Children {
+        Children(nodes: nodes, first: nodes[index].firstChild)
+    }
+
+    /// The fill of a node, if any.
+    public func fill(of index: Int) -> SnapshotPaint? {
+        nodes[index].fillIndex.map { paints[$0] }
+    }
+
+    /// The stroke of a node, if any.
+    public func stroke(of index: Int) -> SnapshotPaint? {
+        nodes[index].strokeIndex.map { paints[$0] }
+    }
+
+    /// Child indices of a node, following `nextSibling` links.
+    public struct Children: Sequence, IteratorProtocol {
+        let nodes: [SnapshotNode]
+        var current: Int?
+
+        init(nodes: [SnapshotNode], first: Int?) {
+            self.nodes = nodes
+            self.current = first
+        }
+
+        public mutating func next() -> Int? {
+            guard let index = current else { return nil }
+            current = nodes[index].nextSibling
+            return index
+        }
+    }
+}
+
+// MARK: - SnapshotNode
+
+/// A node in a `TreeSnapshot`.
+///
+/// Links and paint references are indices into the snapshot's tables.
+public struct SnapshotNode: Sendable, Equatable {
+    static let noIndex = UInt32.max
+
+    let rawParent: UInt32
+    let rawFirstChild: UInt32
+    let rawNextSibling: UInt32
+    let rawFill: UInt32
+    let rawStroke: UInt32
+    let flags: UInt8
+
+    /// The type of this node.
+    public let kind: NodeType
+
+    /// Offset of the ID in `TreeSnapshot.strings`.
+    public let idOffset: UInt32
+
+    /// Length of the ID in bytes.
+    public let idLength: UInt32
+
+    /// Group opacity (0.0 to 1.0); 1 for other nodes.
+    public let opacity: Float
+
+    /// The absolute transform including all ancestor transforms.
+    public let transform: Transform
+
+    /// The bounding box in canvas coordinates, without stroke.
+    public let boundingBox: Rect
+
+    init(_ node: resvg_snapshot_node) {
+        self.rawParent = node.parent
+        self.rawFirstChild = node.first_child
+        self.rawNextSibling = node.next_sibling
+        self.rawFill = node.fill
+        self.rawStroke = node.stroke
+        self.flags = node.flags
+        self.kind = NodeType(rawValue: UInt32(node.kind)) ?? .group
+        self.idOffset = node.id_offset
+        self.idLength = node.id_len
+        self.opacity = node.opacity
+        self.transform = Transform(node.transform)
+        self.boundingBox = Rect(node.bbox)
+    }
+
+    /// Index of the parent, or nil for the root.
+    public var parent: Int? { Self.index(rawParent) }
+
+    /// Index of the first child, or nil if there are none.
+    public var firstChild: Int? { Self.index(rawFirstChild) }
+
+    /// Index of the next sibling, or nil for the last child.
+    public var nextSibling: Int? { Self.index(rawNextSibling) }
+
+    /// Index of the fill in `TreeSnapshot.paints`, if any.
+    public var fillIndex: Int? { Self.index(rawFill) }
+
+    /// Index of the stroke in `TreeSnapshot.paints`, if any.
+    public var strokeIndex: Int? { Self.index(rawStroke) }
+
+    /// Whether this path or image is visible (always false for groups and text).
+    public var isVisible: Bool { flags & UInt8(RESVG_SNAPSHOT_VISIBLE) != 0 }
+
+    /// Whether this group has a mask.
+    public var hasMask: Bool { flags & UInt8(RESVG_SNAPSHOT_HAS_MASK) != 0 }
+
+    /// Whether this group has a clip path.
+    public var hasClipPath: Bool { flags & UInt8(RESVG_SNAPSHOT_HAS_CLIP_PATH) != 0 }
+
+    private static func index(_ raw: UInt32) -> Int? {
+        raw == noIndex ? nil : Int(raw)
+    }
+}
+
+// MARK: - SnapshotPaint
+
+/// A fill or stroke in a `TreeSnapshot`.
+public struct SnapshotPaint: Sendable, Equatable {
+    /// The type of paint.
+    public let paintType: PaintType
+
+    /// The solid color if paintType is .color, black otherwise.
+    public let color: Color
+
+    /// The paint opacity (0.0 to 1.0).
+    public let opacity: Float
+
+    /// The stroke width; 0 for fills.
+    public let width: Float
+
+    init(_ paint: resvg_snapshot_paint) {
+        self.paintType = PaintType(rawValue: UInt32(paint.paint_type)) ?? .color
+        self.color = Color(paint.color)
+        self.opacity = paint.opacity
+        self.width = paint.width
+    }
+}
+
+// MARK: - SvgTree
+
+extension SvgTree {
+    /// Copies the whole tree into a `TreeSnapshot` in one native call.
+    public func snapshot() -> TreeSnapshot {
+        TreeSnapshot(ptr)
+    }
+}
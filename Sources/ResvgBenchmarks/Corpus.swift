@@ -0,0 +1,158 @@
+import Foundation
+
+/// A document the suite benchmarks, with the scales it is rendered at.
+struct CorpusEntry {
+    let name: String
+    let data: Data
+    let scales: [Double]
+}
+
+/// The fixed benchmark corpus.
+///
+/// Synthetic documents are generated deterministically, so results are
+/// comparable across commits. Real documents can be added from a directory.
+enum Corpus {
+    static func synthetic() -> [CorpusEntry] {
+        [
+            CorpusEntry(name: "icon", data: Data(icon().utf8), scales: [1, 2, 3]),
+            CorpusEntry(name: "path-heavy", data: Data(pathHeavy().utf8), scales: [0.5, 1, 2]),
+            CorpusEntry(name: "gradient-heavy", data: Data(gradientHeavy().utf8), scales: [0.5, 1, 2]),
+            CorpusEntry(name: "text-heavy", data: Data(textHeavy().utf8), scales: [0.5, 1, 2]),
+            CorpusEntry(name: "style-heavy", data: Data(styleHeavy().utf8), scales: [0.5, 1]),
+            CorpusEntry(name: "huge-canvas", data: Data(hugeCanvas().utf8), scales: [0.0625, 0.125, 0.25]),
+        ]
+    }
+
+    /// Loads every `.svg` and `.svgz` file in `directory`, rendered at 1x and 2x.
+    static func load(from directory: URL) throws -> [CorpusEntry] {
+        let files = try FileManager.default.contentsOfDirectory(at: directory, includingPropertiesForKeys: nil)
+        return try files
+            .filter { ["svg", "svgz"].contains($0.pathExtension.lowercased()) }
+            .sorted { $0.lastPathComponent < $1.lastPathComponent }
+            .map { CorpusEntry(name: $0.lastPathComponent, data: try Data(contentsOf: $0), scales: [1, 2]) }
+    }
+
+    // MARK: - Generators
+
+    /// A 24x24 toolbar-style icon.
+    static func icon() -> String {
+        """
+        <svg width="24" height="24" viewBox="0 0 24 24" xmlns="http://www.w3.org/2000/svg">
+            <g fill="none" stroke="#1F2937" stroke-width="2" stroke-linecap="round" stroke-linejoin="round">
+                <path d="M3 9l9-7 9 7v11a2 2 0 0 1-2 2H5a2 2 0 0 1-2-2z"/>
+                <polyline points="9 22 9 12 15 12 15 22"/>
+            </g>
+            <circle cx="18" cy="6" r="4" fill="#EF4444"/>
+        </svg>
+        """
+    }
+
+    /// 4,000 cubic-curve paths in nested groups.
+    static func pathHeavy() -> String {
+        var svg = #"<svg width="1024" height="1024" xmlns="http://www.w3.org/2000/svg">"#
+        var random = SplitMix64(seed: 1)
+        for group in 0 ..< 40 {
+            svg += #"<g transform="translate(\#(group % 8 * 128) \#(group / 8 * 200))">"#
+            for _ in 0 ..< 100 {
+                let x = random.next(below: 128)
+                let y = random.next(below: 200)
+                svg += #"<path d="M\#(x) \#(y) c10 -20 30 -20 40 0 s30 20 40 0 l-20 30 q-30 10 -60 -30z""#
+                svg += ##" fill="#\##(random.hexColor())" fill-opacity="0.7" stroke="#000" stroke-width="0.5"/>"##
+            }
+            svg += "</g>"
+        }
+        return svg + "</svg>"
+    }
+
+    /// 300 shapes filled with linear and radial gradients.
+    static func gradientHeavy() -> String {
+        var svg = #"<svg width="1024" height="1024" xmlns="http://www.w3.org/2000/svg"><defs>"#
+        var random = SplitMix64(seed: 2)
+        for index in 0 ..< 300 {
+            let tag = index.isMultiple(of: 2) ? "linearGradient" : "radialGradient"
+            svg += #"<\#(tag) id="g\#(index)">"#
+            for stop in 0 ..< 4 {
+                svg += ##"<stop offset="\##(Double(stop) / 3)" stop-color="#\##(random.hexColor())"/>"##
+            }
+            svg += "</\(tag)>"
+        }
+        svg += "</defs>"
+        for index in 0 ..< 300 {
+            let x = random.next(below: 900)
+            let y = random.next(below: 900)
+            svg += #"<rect x="\#(x)" y="\#(y)" width="120" height="80" rx="12" fill="url(#g\#(index))"/>"#
+        }
+        return svg + "</svg>"
+    }
+
+    /// 200 lines of text using generic font families.
+    static func textHeavy() -> String {
+        var svg = #"<svg width="1024" height="2048" xmlns="http://www.w3.org/2000/svg">"#
+        let families = ["serif", "sans-serif", "monospace"]
+        for line in 0 ..< 200 {
+            svg += #"<text x="8" y="\#(10 + line * 10)" font-size="9" font-family="\#(families[line % 3])">"#
+            svg += "Line \(line): The quick brown fox jumps over the lazy dog 0123456789</text>"
+        }
+        return svg + "</svg>"
+    }
+
+    /// 600 `<use>` instances of 12 symbols styled by a class-based stylesheet.
+    static func styleHeavy() -> String {
+        var svg = #"<svg width="1024" height="1024" xmlns="http://www.w3.org/2000/svg"><style>"#
+        var random = SplitMix64(seed: 3)
+        for index in 0 ..< 12 {
+            svg += ##".c\##(index) { fill: #\##(random.hexColor()); stroke: #\##(random.hexColor()); stroke-width: 2 }"##
+        }
+        svg += "</style><defs>"
+        for index in 0 ..< 12 {
+            svg += #"<symbol id="s\#(index)" viewBox="0 0 40 40">"#
+            svg += #"<path d="M20 2 L38 20 L20 38 L2 20z"/><circle cx="20" cy="20" r="\#(4 + index)"/></symbol>"#
+        }
+        svg += "</defs>"
+        for index in 0 ..< 600 {
+            let x = random.next(below: 984)
+            let y = random.next(below: 984)
+            svg += #"<use href="#s\#(index % 12)" class="c\#(random.next(below: 12))" x="\#(x)" y="\#(y)" width="40" height="40"/>"#
+        }
+        return svg + "</svg>"
+    }
+
+    /// A 16384x16384 floor-plan-like canvas with sparse strokes.
+    static func hugeCanvas() -> String {
+        var svg = #"<svg width="16384" height="16384" xmlns="http://www.w3.org/2000/svg">"#
+        svg += ##"<rect width="16384" height="16384" fill="#F8FAFC"/>"##
+        svg += ##"<g fill="none" stroke="#334155" stroke-width="8">"##
+        for row in 0 ..< 32 {
+            for column in 0 ..< 32 {
+                svg += #"<rect x="\#(column * 512 + 16)" y="\#(row * 512 + 16)" width="480" height="480"/>"#
+            }
+        }
+        return svg + "</g></svg>"
+    }
+}
+
+/// Deterministic pseudo-random numbers for the generators.
+struct SplitMix64 {
+    private var state: UInt64
+
+    init(seed: UInt64) {
+        state = seed
+    }
+
+    mutating func next() -> UInt64 {
+        state &+= 0x9E37_79B9_7F4A_7C15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+        z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+        return z ^ (z >> 31)
+    }
+
+    mutating func next(below bound: Int) -> Int {
+        Int(next() % UInt64(bound))
+    }
+
+    mutating func hexColor() -> String {
+        let digits = String(next() & 0xFFFFFF, radix: 16)
+        return String(repeating: "0", count: 6 - digits.count) + digits
+    }
+}
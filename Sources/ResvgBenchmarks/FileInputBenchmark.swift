@@ -0,0 +1,112 @@
+import Foundation
+import Resvg
+
+/// Compares reading a file into the heap (`Data(contentsOf:)`) with the
+/// library's file entry point, which memory-maps large files.
+///
+/// Each mode runs in a fresh child process so peak RSS is not shared.
+/// Output is one JSON object per mode.
+enum FileInputBenchmark {
+    struct Result: Codable {
+        let mode: String
+        let fileBytes: Int
+        let parseSeconds: Double
+        let peakRSSBytes: Int
+    }
+
+    static func run(_ arguments: [String]) throws {
+        if arguments.first == "--child", arguments.count == 3 {
+            try child(mode: arguments[1], path: arguments[2])
+            return
+        }
+
+        var sizeMB = 128
+        var file: URL?
+        var index = 0
+        while index < arguments.count {
+            switch arguments[index] {
+            case "--size-mb" where index + 1 < arguments.count:
+                sizeMB = Int(arguments[index + 1]) ?? sizeMB
+                index += 1
+            case "--file" where index + 1 < arguments.count:
+                file = URL(fileURLWithPath: arguments[index + 1])
+                index += 1
+            default:
+                break
+            }
+            index += 1
+        }
+
+        let url = try file ?? generate(bytes: sizeMB * 1024 * 1024)
+        defer {
+            if file == nil {
+                try? FileManager.default.removeItem(at: url)
+            }
+        }
+
+        for mode in ["read", "library"] {
+            let process = Process()
+            process.executableURL = Bundle.main.executableURL
+            process.arguments = ["file-input", "--child", mode, url.path]
+            try process.run()
+            process.waitUntilExit()
+        }
+    }
+
+    static func child(mode: String, path: String) throws {
+        let url = URL(fileURLWithPath: path)
+        let (tree, seconds) = try ProcessStats.measure { () -> SvgTree in
+            switch mode {
+            case "read":
+                try SvgTree(data: Data(contentsOf: url))
+            default:
+                try SvgTree(file: url)
+            }
+        }
+
+        let result = Result(
+            mode: mode,
+            fileBytes: (try? url.resourceValues(forKeys: [.fileSizeKey]).fileSize) ?? 0,
+            parseSeconds: seconds,
+            peakRSSBytes: ProcessStats.peakResidentBytes()
+        )
+        withExtendedLifetime(tree) {}
+
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = .sortedKeys
+        print(String(decoding: try encoder.encode(result), as: UTF8.self))
+    }
+
+    /// Writes a synthetic SVG of roughly `bytes` bytes.
+    ///
+    /// Paths carry many segments each to stay well below resvg's element limit.
+    static func generate(bytes: Int) throws -> URL {
+        let url = FileManager.default.temporaryDirectory
+            .appendingPathComponent("resvg-file-input-\(UUID().uuidString).svg")
+        FileManager.default.createFile(atPath: url.path, contents: nil)
+        let handle = try FileHandle(forWritingTo: url)
+        defer { try? handle.close() }
+
+        handle.write(Data(#"<svg width="4096" height="4096" xmlns="http://www.w3.org/2000/svg">"#.utf8))
+        var written = 0
+        var shape = 0
+        while written < bytes {
+            var chunk = ""
+            for _ in 0 ..< 100 {
+                let x = shape % 4000
+                let y = (shape / 4000) % 4000
+                chunk += ##"<path fill="#3366CC" d="M\##(x) \##(y)"##
+                for _ in 0 ..< 25 {
+                    chunk += " l8 0 l0 8 l-8 0 l0 -8"
+                }
+                chunk += "\"/>\n"
+                shape += 1
+            }
+            let data = Data(chunk.utf8)
+            handle.write(data)
+            written += data.count
+        }
+        handle.write(Data("</svg>\n".utf8))
+        return url
+    }
+}
@@ -0,0 +1,65 @@
+import Foundation
+
+/// One measured benchmark.
+struct BenchmarkResult: Codable {
+    /// Benchmark name, e.g. `rasterize@2x`.
+    let benchmark: String
+
+    /// Corpus entry the benchmark ran on.
+    let corpus: String
+
+    let iterations: Int
+    let nsPerOp: Double
+
+    /// Heap bytes still held by the result of one operation (e.g. a parsed tree).
+    let bytesAllocated: Int
+
+    /// Peak RSS of the process after the benchmark.
+    let peakRSSBytes: Int
+}
+
+/// Times closures until a minimum duration has elapsed.
+struct Harness {
+    /// Minimum measured time per benchmark, in seconds.
+    var minTime: Double = 0.5
+
+    /// Only benchmarks whose `name/corpus` contains this string are run.
+    var filter: String?
+
+    private(set) var results: [BenchmarkResult] = []
+
+    /// Measures `body`, whose return value is kept alive while heap usage is sampled.
+    mutating func measure<T>(_ name: String, corpus: String, _ body: () throws -> T) rethrows {
+        if let filter, !"\(name)/\(corpus)".contains(filter) {
+            return
+        }
+
+        // Warm-up, which also measures what one result holds on the heap.
+        let heapBefore = ProcessStats.heapBytesInUse()
+        let warmup = try body()
+        let bytesAllocated = max(0, ProcessStats.heapBytesInUse() - heapBefore)
+        withExtendedLifetime(warmup) {}
+
+        var iterations = 0
+        var elapsed = 0.0
+        while elapsed < minTime || iterations < 3 {
+            let (result, seconds) = try ProcessStats.measure(body)
+            withExtendedLifetime(result) {}
+            elapsed += seconds
+            iterations += 1
+        }
+
+        let result = BenchmarkResult(
+            benchmark: name,
+            corpus: corpus,
+            iterations: iterations,
+            nsPerOp: elapsed * 1_000_000_000 / Double(iterations),
+            bytesAllocated: bytesAllocated,
+            peakRSSBytes: ProcessStats.peakResidentBytes()
+        )
+        results.append(result)
+        FileHandle.standardError.write(Data(
+            "\(name) \(corpus): \(Int(result.nsPerOp)) ns/op, \(bytesAllocated) bytes\n".utf8
+        ))
+    }
+}
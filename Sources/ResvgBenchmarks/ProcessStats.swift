@@ -0,0 +1,46 @@
+import Foundation
+
+/// Process-level resource measurements.
+enum ProcessStats {
+    /// Peak resident set size of the current process in bytes, or 0 if unknown.
+    static func peakResidentBytes() -> Int {
+        #if canImport(Darwin)
+        var usage = rusage()
+        getrusage(RUSAGE_SELF, &usage)
+        return Int(usage.ru_maxrss) // bytes on Darwin
+        #elseif os(Linux)
+        // VmHWM is the peak RSS in kB.
+        guard let status = try? String(contentsOfFile: "/proc/self/status", encoding: .utf8) else { return 0 }
+        for line in status.split(separator: "\n") where line.hasPrefix("VmHWM:") {
+            let fields = line.split(separator: " ", omittingEmptySubsequences: true)
+            return fields.count >= 2 ? (Int(fields[1]) ?? 0) * 1024 : 0
+        }
+        return 0
+        #else
+        return 0
+        #endif
+    }
+
+    /// Bytes currently allocated from the malloc heap, or 0 if unknown.
+    ///
+    /// Rust allocations in resvg go through the same allocator, so they are included.
+    static func heapBytesInUse() -> Int {
+        #if canImport(Darwin)
+        var stats = malloc_statistics_t()
+        malloc_zone_statistics(nil, &stats)
+        return Int(stats.size_in_use)
+        #elseif canImport(Glibc)
+        return Int(mallinfo2().uordblks)
+        #else
+        return 0
+        #endif
+    }
+
+    /// Seconds elapsed while running `body`.
+    static func measure<T>(_ body: () throws -> T) rethrows -> (result: T, seconds: Double) {
+        let start = DispatchTime.now().uptimeNanoseconds
+        let result = try body()
+        let end = DispatchTime.now().uptimeNanoseconds
+        return (result, Double(end - start) / 1_000_000_000)
+    }
+}
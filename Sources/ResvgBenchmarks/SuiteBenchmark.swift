@@ -0,0 +1,177 @@
+import Foundation
+import Resvg
+
+/// Measures the library's hot paths over the benchmark corpus.
+///
+/// Covers parsing, loading a resolved document, traversal, path extraction, rasterization at several
+/// scales and qualities, unpremultiply and normalization. Output is a JSON array of
+/// `BenchmarkResult`, so runs can be diffed across commits.
+enum SuiteBenchmark {
+    struct Report: Codable {
+        let results: [BenchmarkResult]
+
+        /// Corpus entries that stopped with an error, with their benchmarks so far kept in `results`.
+        let failures: [BenchmarkFailure]
+    }
+
+    struct BenchmarkFailure: Codable {
+        let corpus: String
+        let error: String
+    }
+
+    static func run(_ arguments: [String]) throws {
+        var harness = Harness()
+        var corpusDirectory: URL?
+        var output: URL?
+        var index = 0
+        while index < arguments.count {
+            switch arguments[index] {
+            case "--min-time" where index + 1 < arguments.count:
+                harness.minTime = Double(arguments[index + 1]) ?? harness.minTime
+                index += 1
+            case "--filter" where index + 1 < arguments.count:
+                harness.filter = arguments[index + 1]
+                index += 1
+            case "--corpus" where index + 1 < arguments.count:
+                corpusDirectory = URL(fileURLWithPath: arguments[index + 1])
+                index += 1
+            case "--output" where index + 1 < arguments.count:
+                output = URL(fileURLWithPath: arguments[index + 1])
+                index += 1
+            default:
+                break
+            }
+            index += 1
+        }
+
+        var corpus = Corpus.synthetic()
+        if let corpusDirectory {
+            corpus += try Corpus.load(from: corpusDirectory)
+        }
+
+        // Without fonts usvg drops every <text>, leaving text entries empty.
+        // Loading system fonts is slow, so each quality gets one shared context.
+        var contexts: [RenderQuality: RenderContext] = [:]
+        for quality in [RenderQuality.preview, .balanced, .best] {
+            contexts[quality] = try RenderContext(options: RenderOptions(quality: quality, loadsSystemFonts: true))
+        }
+
+        var failures: [BenchmarkFailure] = []
+        for entry in corpus {
+            do {
+                try measure(entry, contexts: contexts, harness: &harness)
+            } catch {
+                failures.append(BenchmarkFailure(corpus: entry.name, error: error.localizedDescription))
+                FileHandle.standardError.write(Data("\(entry.name): failed: \(error.localizedDescription)\n".utf8))
+            }
+        }
+
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        let json = try encoder.encode(Report(results: harness.results, failures: failures))
+        if let output {
+            try json.write(to: output)
+        } else {
+            print(String(decoding: json, as: UTF8.self))
+        }
+    }
+
+    /// Runs every benchmark on one entry; `contexts` holds a font-loading context per quality.
+    static func measure(
+        _ entry: CorpusEntry,
+        contexts: [RenderQuality: RenderContext],
+        harness: inout Harness
+    ) throws {
+        let context = contexts[.best]!
+        let rasterizer = SvgRasterizer(context: context)
+        let normalizer = SvgNormalizer(context: context)
+        let tree = try SvgTree(data: entry.data, context: context)
+
+        try harness.measure("parse", corpus: entry.name) {
+            try SvgTree(data: entry.data, context: context)
+        }
+
+        // A full parse of the resolved SVG; compare with "parse" to see what
+        // skipping CSS, <use> expansion and text layout saves per document.
+        let resolved = try tree.resolvedDocument()
+        try harness.measure("load-resolved", corpus: entry.name) {
+            try SvgTree(resolvedDocument: resolved, context: context)
+        }
+
+        let recolorer = try SvgRecolorer(data: entry.data, context: context)
+        let theme = PaintOverrides(colors: [Color(r: 0, g: 0, b: 0): Color(r: 0x33, g: 0x66, b: 0x99)])
+        try harness.measure("recolor", corpus: entry.name) {
+            try recolorer.tree(with: theme)
+        }
+
+        try harness.measure("cost-estimate", corpus: entry.name) {
+            try tree.costEstimate()
+        }
+
+        harness.measure("traverse", corpus: entry.name) {
+            visit(tree.root)
+        }
+
+        harness.measure("snapshot", corpus: entry.name) {
+            tree.snapshot()
+        }
+
+        harness.measure("path-segments", corpus: entry.name) {
+            paths(in: tree.root).reduce(0) { $0 + $1.segments.count }
+        }
+
+        for scale in entry.scales {
+            try harness.measure("rasterize@\(scale)x", corpus: entry.name) {
+                try rasterizer.rasterize(tree: tree, scale: scale)
+            }
+        }
+
+        // Quality is applied while parsing, so each mode renders its own tree.
+        let scale = entry.scales.contains(1) ? 1 : entry.scales[0]
+        for quality in [RenderQuality.preview, .balanced, .best] {
+            let qualityTree = try SvgTree(data: entry.data, context: contexts[quality]!)
+            try harness.measure("rasterize[\(quality)]@\(scale)x", corpus: entry.name) {
+                try rasterizer.rasterize(tree: qualityTree, scale: scale)
+            }
+        }
+
+        // Unpremultiply on the 1x (or first) rendering, restoring the input each time.
+        let premultiplied = try rasterizer.rasterize(tree: tree, scale: scale, pixelFormat: .premultipliedRGBA).rgba
+        var pixels = premultiplied
+        harness.measure("unpremultiply@\(scale)x", corpus: entry.name) {
+            pixels.withUnsafeMutableBytes { bytes in
+                _ = premultiplied.withUnsafeBytes { bytes.copyMemory(from: $0) }
+                PixelFormat.straightRGBA.convertFromPremultipliedRGBA(bytes)
+            }
+        }
+
+        try harness.measure("normalize", corpus: entry.name) {
+            try normalizer.normalize(entry.data)
+        }
+    }
+
+    /// Visits every node below `group` and returns the node count.
+    static func visit(_ group: Group) -> Int {
+        var count = 0
+        for child in group.children {
+            count += 1
+            if let group = child.asGroup() {
+                count += visit(group)
+            }
+        }
+        return count
+    }
+
+    /// Every path below `group`, in document order.
+    static func paths(in group: Group) -> [Path] {
+        var result: [Path] = []
+        for child in group.children {
+            if let group = child.asGroup() {
+                result += paths(in: group)
+            } else if let path = child.asPath() {
+                result.append(path)
+            }
+        }
+        return result
+    }
+}
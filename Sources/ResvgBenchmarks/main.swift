@@ -0,0 +1,28 @@
+import Foundation
+
+// Usage: ResvgBenchmarks <benchmark> [options]
+let arguments = Array(CommandLine.arguments.dropFirst())
+
+do {
+    switch arguments.first {
+    case "suite":
+        try SuiteBenchmark.run(Array(arguments.dropFirst()))
+    case "file-input":
+        try FileInputBenchmark.run(Array(arguments.dropFirst()))
+    default:
+        print("""
+            Usage: ResvgBenchmarks <benchmark> [options]
+
+            Benchmarks:
+              suite [--min-time seconds] [--filter text] [--corpus dir] [--output file]
+                  Parse, traverse, path segments, rasterize, unpremultiply and normalize
+                  over the built-in corpus (plus any SVGs in --corpus), as JSON.
+              file-input [--size-mb N] [--file path]
+                  Peak RSS and parse latency of reading vs memory-mapping SVG files.
+            """)
+        exit(arguments.isEmpty ? 0 : 1)
+    }
+} catch {
+    FileHandle.standardError.write(Data("error: \(error)\n".utf8))
+    exit(1)
+}
@@ -0,0 +1,88 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("Async Rendering Tests")
+struct AsyncRenderingTests {
+    let svg = Data("""
+        <svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">
+            <rect width="100" height="50" fill="#FF0000"/>
+            <circle cx="50" cy="75" r="20" fill="#0000FF" fill-opacity="0.5"/>
+        </svg>
+        """.utf8)
+
+    @Test("Matches synchronous rasterization")
+    func matchesSynchronous() async throws {
+        let rasterizer = SvgRasterizer()
+        let expected = try rasterizer.rasterize(data: svg, scale: 2)
+        let image = try await rasterizer.rasterize(data: svg, scale: 2, deadline: .distantFuture)
+
+        #expect(image.width == expected.width)
+        #expect(image.height == expected.height)
+        #expect(image.rgba == expected.rgba)
+    }
+
+    @Test("Matches synchronous rasterization of large images")
+    func matchesSynchronousLarge() async throws {
+        // 1600x1600 at scale 16; anti-aliased edges must match exactly.
+        let rasterizer = SvgRasterizer()
+        let tree = try SvgTree(data: svg)
+        let expected = try rasterizer.rasterize(tree: tree, scale: 16)
+        let image = try await rasterizer.rasterize(tree: tree, scale: 16, deadline: .distantFuture)
+
+        #expect(image.rgba == expected.rgba)
+    }
+
+    @Test("Parses and normalizes asynchronously")
+    func parsesAndNormalizes() async throws {
+        let tree = try await SvgTree.parse(data: svg, deadline: .distantFuture)
+        let normalized = try await SvgNormalizer().normalize(svg, deadline: .distantFuture)
+
+        #expect(tree.size.width == 100)
+        #expect(normalized == (try SvgNormalizer().normalize(svg)))
+    }
+
+    @Test("Throws when the deadline has passed")
+    func throwsAfterDeadline() async throws {
+        await #expect(throws: ResvgError.deadlineExceeded) {
+            try await SvgRasterizer().rasterize(data: svg, deadline: .now())
+        }
+    }
+
+    @Test("Throws when the task is cancelled")
+    func throwsWhenCancelled() async throws {
+        let svg = svg
+        let task = Task {
+            withUnsafeCurrentTask { $0?.cancel() }
+            return try await SvgRasterizer().rasterize(data: svg, deadline: .distantFuture)
+        }
+
+        await #expect(throws: CancellationError.self) {
+            try await task.value
+        }
+    }
+
+    @Test("Reads files asynchronously")
+    func readsFiles() async throws {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("async-\(UUID().uuidString).svg")
+        try svg.write(to: url)
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let image = try await SvgRasterizer().rasterize(file: url, deadline: .distantFuture)
+        let tree = try await SvgTree.parse(file: url, deadline: .distantFuture)
+
+        #expect(image.rgba == (try SvgRasterizer().rasterize(data: svg)).rgba)
+        #expect(tree.size.width == 100)
+        await #expect(throws: ResvgError.fileOpenFailed(path: url.path + ".missing")) {
+            try await SvgTree.parse(file: url.appendingPathExtension("missing"), deadline: .distantFuture)
+        }
+    }
+
+    @Test("Reports parse errors")
+    func reportsParseErrors() async throws {
+        await #expect(throws: ResvgError.self) {
+            try await SvgTree.parse(data: Data("not svg".utf8), deadline: .distantFuture)
+        }
+    }
+}
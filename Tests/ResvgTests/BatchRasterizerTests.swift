@@ -0,0 +1,84 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("BatchRasterizer Tests")
+struct BatchRasterizerTests {
+    func square(_ size: Int) -> BatchRasterizer.Input {
+        .data(Data("""
+            <svg width="\(size)" height="\(size)" xmlns="http://www.w3.org/2000/svg">
+                <rect width="\(size)" height="\(size)" fill="red"/>
+            </svg>
+            """.utf8))
+    }
+
+    @Test("Delivers results in input order")
+    func deliversInInputOrder() async throws {
+        let inputs = (1 ... 20).map { square($0 * 10) }
+        let batch = BatchRasterizer(maxConcurrency: 3)
+        var indices: [Int] = []
+        var widths: [Int] = []
+
+        try await batch.rasterize(inputs, order: .input) { item in
+            indices.append(item.index)
+            widths.append(try item.result.get().width)
+        }
+
+        #expect(indices == Array(0 ..< 20))
+        #expect(widths == (1 ... 20).map { $0 * 10 })
+    }
+
+    @Test("Reports per-item errors without aborting")
+    func reportsPerItemErrors() async throws {
+        let missing = URL(fileURLWithPath: "/nonexistent/icon.svg")
+        let inputs: [BatchRasterizer.Input] = [square(10), .data(Data("not an svg".utf8)), .file(missing), square(20)]
+        var results: [Int: Result<RasterizedSvg, ResvgError>] = [:]
+
+        try await BatchRasterizer(maxConcurrency: 2).rasterize(inputs) { item in
+            results[item.index] = item.result
+        }
+
+        #expect(results.count == 4)
+        #expect(try results[0]?.get().width == 10)
+        #expect(try results[3]?.get().width == 20)
+        #expect(throws: ResvgError.self) { try results[1]?.get() }
+        #expect(throws: ResvgError.fileOpenFailed(path: missing.path)) { try results[2]?.get() }
+    }
+
+    @Test("Pulls sequence inputs only as slots free up")
+    func pullsLazily() async throws {
+        final class Counter {
+            var pulled = 0
+        }
+        let counter = Counter()
+        let inputs = (0 ..< 50).lazy.map { _ -> BatchRasterizer.Input in
+            counter.pulled += 1
+            return self.square(10)
+        }
+        var delivered = 0
+        var maxAhead = 0
+
+        try await BatchRasterizer(maxConcurrency: 3).rasterize(inputs) { _ in
+            delivered += 1
+            maxAhead = max(maxAhead, counter.pulled - delivered)
+        }
+
+        #expect(delivered == 50)
+        #expect(maxAhead <= 3)
+    }
+
+    @Test("Bounds results awaiting delivery")
+    func boundsWaitingResults() {
+        var delivery = BatchRasterizer.Delivery(order: .input)
+        func item(_ index: Int) -> BatchRasterizer.Item {
+            BatchRasterizer.Item(index: index, input: .data(Data()), result: .failure(.parsingFailed))
+        }
+
+        #expect(delivery.accept(item(2)).isEmpty)
+        #expect(delivery.accept(item(1)).isEmpty)
+        #expect(delivery.waiting == 2)
+        #expect(delivery.accept(item(0)).map(\.index) == [0, 1, 2])
+        #expect(delivery.waiting == 0)
+    }
+}
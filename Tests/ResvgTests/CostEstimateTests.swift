@@ -0,0 +1,93 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("Cost Estimate Tests")
+struct CostEstimateTests {
+    /// A 2x1 PNG.
+    let pngBase64 = "iVBORw0KGgoAAAANSUhEUgAAAAIAAAABCAYAAAD0In+KAAAADklEQVR4nGP4z8AAQg0AD3oDfnfpf5cAAAAASUVORK5CYII="
+
+    let simpleSvg = Data("""
+        <svg width="100" height="50" xmlns="http://www.w3.org/2000/svg">
+            <rect width="10" height="10" fill="red"/>
+        </svg>
+        """.utf8)
+
+    var complexSvg: Data {
+        Data("""
+            <svg width="100" height="50" xmlns="http://www.w3.org/2000/svg">
+                <defs>
+                    <linearGradient id="fade"><stop offset="0" stop-color="red"/><stop offset="1" stop-color="blue"/></linearGradient>
+                    <clipPath id="clip"><rect width="50" height="50"/></clipPath>
+                    <mask id="mask"><rect width="100" height="50" fill="white"/></mask>
+                    <filter id="blur"><feGaussianBlur stdDeviation="2"/></filter>
+                </defs>
+                <g opacity="0.5" clip-path="url(#clip)">
+                    <rect width="100" height="50" fill="url(#fade)"/>
+                </g>
+                <g mask="url(#mask)" filter="url(#blur)">
+                    <circle cx="50" cy="25" r="20" fill="green" stroke="black" stroke-width="2"/>
+                </g>
+                <image width="20" height="10" href="data:image/png;base64,\(pngBase64)"/>
+            </svg>
+            """.utf8)
+    }
+
+    @Test("Counts nodes, paints and layers")
+    func countsWork() throws {
+        let cost = try SvgTree(data: complexSvg).costEstimate()
+
+        #expect(cost.imageCount == 1)
+        #expect(cost.imagePixels == 2)
+        #expect(cost.gradientCount == 1)
+        #expect(cost.clipPathCount == 1)
+        #expect(cost.maskCount == 1)
+        #expect(cost.filterCount == 1)
+        #expect(cost.layerCount >= 2)
+        #expect(cost.pathCount >= 4) // two shapes plus clip and mask content
+        #expect(cost.pathSegmentCount > cost.pathCount)
+        #expect(cost.gradientPixels == 100 * 50)
+        #expect(cost.layerPixels > 0)
+        #expect(cost.filterPixels > 0)
+        #expect(cost.outputPixels == 100 * 50)
+    }
+
+    @Test("Scales areas with the output scale")
+    func scalesAreas() throws {
+        let tree = try SvgTree(data: simpleSvg)
+        let native = try tree.costEstimate()
+        let doubled = try tree.costEstimate(scale: 2)
+
+        #expect(native.paintedPixels == 100)
+        #expect(doubled.outputPixels == 4 * native.outputPixels)
+        #expect(doubled.paintedPixels == 4 * native.paintedPixels)
+        #expect(doubled.pathSegmentCount == native.pathSegmentCount)
+    }
+
+    @Test("Scores heavier documents higher")
+    func ordersDocuments() throws {
+        let simple = try SvgTree(data: simpleSvg).costEstimate()
+        let complex = try SvgTree(data: complexSvg).costEstimate()
+        #expect(complex.score() > simple.score())
+        #expect(simple.score() > 0)
+    }
+
+    @Test("Calibrates weights to measured times")
+    func calibratesWeights() throws {
+        let estimate = try SvgTree(data: complexSvg).costEstimate()
+        let measured = UInt64(estimate.score() * 3)
+        let weights = RenderCostWeights.default.calibrated(to: [(estimate, measured)])
+
+        #expect(abs(estimate.score(weights: weights) - Double(measured)) < 1)
+        #expect(RenderCostWeights.default.calibrated(to: []) == .default)
+    }
+
+    @Test("Rejects non-positive scales")
+    func rejectsInvalidScale() throws {
+        let tree = try SvgTree(data: simpleSvg)
+        #expect(throws: ResvgError.invalidSize) {
+            try tree.costEstimate(scale: 0)
+        }
+    }
+}
@@ -0,0 +1,70 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("Encoding Tests")
+struct EncodingTests {
+    let svg = Data("""
+        <svg width="40" height="30" xmlns="http://www.w3.org/2000/svg">
+            <rect width="40" height="30" fill="#FF0000" fill-opacity="0.5"/>
+            <circle cx="20" cy="15" r="10" fill="#0000FF"/>
+        </svg>
+        """.utf8)
+
+    private func bigEndianUInt32(_ data: Data, at offset: Int) -> UInt32 {
+        data[data.startIndex + offset ..< data.startIndex + offset + 4].reduce(0) { $0 << 8 | UInt32($1) }
+    }
+
+    @Test("Encodes PNG with the scaled size")
+    func encodesPng() throws {
+        let png = try SvgRasterizer().rasterize(data: svg, scale: 2, encoding: .png())
+
+        #expect(png.prefix(8) == Data([0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A]))
+        #expect(png[png.startIndex + 12 ..< png.startIndex + 16] == Data("IHDR".utf8))
+        #expect(bigEndianUInt32(png, at: 16) == 80)
+        #expect(bigEndianUInt32(png, at: 20) == 60)
+    }
+
+    @Test("PNG compression levels all produce valid files")
+    func pngCompressionLevels() throws {
+        let rasterizer = SvgRasterizer()
+        let tree = try SvgTree(data: svg)
+
+        let sizes = try [PNGCompression.fast, .default, .best].map { compression in
+            let png = try rasterizer.rasterize(tree: tree, scale: 4, encoding: .png(compression: compression))
+            #expect(png.suffix(8).prefix(4) == Data("IEND".utf8))
+            return png.count
+        }
+        #expect(sizes[2] <= sizes[0])
+    }
+
+    @Test("Encodes QOI with straight alpha")
+    func encodesQoi() throws {
+        let rasterizer = SvgRasterizer()
+        let qoi = try rasterizer.rasterize(data: svg, encoding: .qoi)
+
+        #expect(qoi.prefix(4) == Data("qoif".utf8))
+        #expect(bigEndianUInt32(qoi, at: 4) == 40)
+        #expect(bigEndianUInt32(qoi, at: 8) == 30)
+        #expect(qoi[qoi.startIndex + 12] == 4)
+        #expect(qoi.suffix(8) == Data([0, 0, 0, 0, 0, 0, 0, 1]))
+
+        // The first pixel is half-transparent red; QOI_OP_RGBA carries it unpremultiplied.
+        let expected = try rasterizer.rasterize(data: svg).rgba.prefix(4)
+        #expect(qoi[qoi.startIndex + 14] == 0xFF)
+        #expect(qoi[qoi.startIndex + 15 ..< qoi.startIndex + 19] == Data(expected))
+    }
+
+    @Test("Writes encoded image to a file")
+    func writesToFile() throws {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("encoded-\(UUID().uuidString).png")
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let rasterizer = SvgRasterizer()
+        let tree = try SvgTree(data: svg)
+        try rasterizer.rasterize(tree: tree, encoding: .png(), to: url)
+
+        #expect(try Data(contentsOf: url) == rasterizer.rasterize(tree: tree, encoding: .png()))
+    }
+}
@@ -0,0 +1,71 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("Image Loading Tests")
+struct ImageLoadingTests {
+    /// A 2x1 PNG: opaque red, then half-transparent blue.
+    let pngBase64 = "iVBORw0KGgoAAAANSUhEUgAAAAIAAAABCAYAAAD0In+KAAAADklEQVR4nGP4z8AAQg0AD3oDfnfpf5cAAAAASUVORK5CYII="
+
+    var svg: Data {
+        Data("""
+            <svg width="20" height="10" xmlns="http://www.w3.org/2000/svg">
+                <rect id="background" width="20" height="10" fill="white"/>
+                <image id="photo" width="20" height="10" href="data:image/png;base64,\(pngBase64)"/>
+            </svg>
+            """.utf8)
+    }
+
+    @Test("Exposes the encoded bytes of an embedded image")
+    func exposesEncodedData() throws {
+        let tree = try SvgTree(data: svg)
+        let image = try #require(tree.nodes(ofType: .image).first?.asImage())
+
+        #expect(image.kind == .png)
+        #expect(image.encodedData == Data(base64Encoded: pngBase64))
+    }
+
+    @Test("Decodes pixels on request")
+    func decodesPixels() throws {
+        let tree = try SvgTree(data: svg)
+        let image = try #require(tree.nodes(ofType: .image).first?.asImage())
+        let pixels = try #require(image.decodedPixels())
+
+        #expect(pixels.width == 2)
+        #expect(pixels.height == 1)
+        #expect(pixels.rgba == [255, 0, 0, 255, 0, 0, 255, 128])
+    }
+
+    @Test("Has no encoded data or pixels for nested SVG images")
+    func skipsNestedSvg() throws {
+        let nested = Data(#"<svg xmlns="http://www.w3.org/2000/svg" width="4" height="4"/>"#.utf8).base64EncodedString()
+        let tree = try SvgTree(data: Data("""
+            <svg width="10" height="10" xmlns="http://www.w3.org/2000/svg">
+                <image width="10" height="10" href="data:image/svg+xml;base64,\(nested)"/>
+            </svg>
+            """.utf8))
+        let image = try #require(tree.nodes(ofType: .image).first?.asImage())
+
+        #expect(image.kind == .svg)
+        #expect(image.encodedData == nil)
+        #expect(image.decodedPixels() == nil)
+    }
+
+    @Test("Leaves images out of the tree when skipping")
+    func skipsImages() throws {
+        let context = try RenderContext(options: RenderOptions(imageLoading: .skip))
+        let tree = try SvgTree(data: svg, context: context)
+
+        #expect(tree.nodes(ofType: .image).isEmpty)
+        #expect(tree.nodes(ofType: .path).map(\.id) == ["background"])
+
+        let normalized = try SvgNormalizer(context: context).normalizeToString(svg)
+        #expect(!normalized.contains("<image"))
+    }
+
+    @Test("Keys the render cache by image loading")
+    func cacheKeyIncludesImageLoading() {
+        #expect(RenderOptions().cacheDigest != RenderOptions(imageLoading: .skip).cacheDigest)
+    }
+}
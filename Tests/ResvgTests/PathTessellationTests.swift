@@ -0,0 +1,155 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("Path Tessellation Tests")
+struct PathTessellationTests {
+    private func path(_ body: String, id: String) throws -> Path {
+        let svg = #"<svg width="200" height="200" xmlns="http://www.w3.org/2000/svg">\#(body)</svg>"#
+        let tree = try SvgTree(data: Data(svg.utf8))
+        return try #require(tree.node(withID: id)?.asPath())
+    }
+
+    private func area(_ mesh: TriangleMesh) -> Float {
+        stride(from: 0, to: mesh.indices.count, by: 3).reduce(0) { total, i in
+            let a = mesh.vertices[Int(mesh.indices[i])]
+            let b = mesh.vertices[Int(mesh.indices[i + 1])]
+            let c = mesh.vertices[Int(mesh.indices[i + 2])]
+            return total + abs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2
+        }
+    }
+
+    @Test("Flattens a rectangle into one closed polyline")
+    func flattensRectangle() throws {
+        let rect = try path(#"<rect id="r" x="10" y="20" width="30" height="40"/>"#, id: "r")
+        let polylines = try rect.flattened()
+
+        #expect(polylines.count == 1)
+        #expect(polylines[0].isClosed)
+        #expect(polylines[0].points.first == SIMD2(10, 20))
+        #expect(Set(polylines[0].points.map { [$0.x, $0.y] }) == [[10, 20], [40, 20], [40, 60], [10, 60]])
+    }
+
+    @Test("Flattened curves stay within tolerance")
+    func flattenedCurvesWithinTolerance() throws {
+        let circle = try path(#"<circle id="c" cx="100" cy="100" r="50"/>"#, id: "c")
+
+        for tolerance: Float in [1, 0.1, 0.01] {
+            let points = try #require(circle.flattened(tolerance: tolerance).first).points
+            #expect(points.count > 8)
+            for point in points {
+                let radius = ((point.x - 100) * (point.x - 100) + (point.y - 100) * (point.y - 100)).squareRoot()
+                #expect(abs(radius - 50) <= tolerance + 0.001)
+            }
+        }
+    }
+
+    @Test("Splits subpaths and keeps open ones open")
+    func splitsSubpaths() throws {
+        let shape = try path(#"<path id="p" d="M0 0 L10 0 L10 10 Z M20 20 L30 20" fill="none" stroke="black"/>"#, id: "p")
+        let polylines = try shape.flattened()
+
+        #expect(polylines.map(\.isClosed) == [true, false])
+        #expect(polylines.map(\.points.count) == [3, 2])
+    }
+
+    @Test("Applies the absolute transform on request")
+    func appliesAbsoluteTransform() throws {
+        let rect = try path(#"<g transform="translate(100 50)"><rect id="r" width="10" height="10"/></g>"#, id: "r")
+
+        #expect(try rect.flattened()[0].points.first == SIMD2(0, 0))
+        #expect(try rect.flattened(absolute: true)[0].points.first == SIMD2(100, 50))
+        #expect(try rect.triangulated(absolute: true).vertices.allSatisfy { $0.x >= 100 && $0.y >= 50 })
+    }
+
+    @Test("Triangulates a rectangle")
+    func triangulatesRectangle() throws {
+        let rect = try path(#"<rect id="r" width="30" height="40"/>"#, id: "r")
+        let mesh = try rect.triangulated()
+
+        #expect(mesh.triangleCount == 2)
+        #expect(mesh.indices.allSatisfy { Int($0) < mesh.vertices.count })
+        #expect(abs(area(mesh) - 1200) < 0.01)
+    }
+
+    @Test("Triangulation follows the fill rule")
+    func triangulationFollowsFillRule() throws {
+        // Two squares drawn in the same direction: a hole only under even-odd.
+        let square = try path(
+            #"<path id="p" d="M0 0 H100 V100 H0 Z M25 25 H75 V75 H25 Z" fill-rule="evenodd"/>"#,
+            id: "p"
+        )
+
+        #expect(try abs(area(square.triangulated()) - 7500) < 0.1)
+        #expect(try abs(area(square.triangulated(fillRule: .nonZero)) - 10000) < 0.1)
+    }
+
+    @Test("Throws for a non-positive tolerance")
+    func throwsForInvalidTolerance() throws {
+        let rect = try path(#"<rect id="r" width="10" height="10"/>"#, id: "r")
+
+        #expect(throws: ResvgError.invalidTolerance(0)) {
+            try rect.flattened(tolerance: 0)
+        }
+        #expect(throws: ResvgError.invalidTolerance(-1)) {
+            try rect.triangulated(tolerance: -1)
+        }
+    }
+
+    // MARK: - Stroke Outline
+
+    @Test("Outlines a stroked line as a filled rectangle")
+    func outlinesStrokedLine() throws {
+        let line = try path(#"<path id="p" d="M10 50 H90" stroke="black" stroke-width="10"/>"#, id: "p")
+        let outline = try #require(line.strokeOutline())
+
+        let xs = outline.points.map(\.x)
+        let ys = outline.points.map(\.y)
+        #expect(xs.min() == 10 && xs.max() == 90)
+        #expect(ys.min() == 45 && ys.max() == 55)
+        #expect(outline.verbs.last == UInt8(SegmentType.close.rawValue))
+    }
+
+    @Test("Applies caps to the outline")
+    func appliesCaps() throws {
+        let line = try path(
+            #"<path id="p" d="M10 50 H90" stroke="black" stroke-width="10" stroke-linecap="square"/>"#,
+            id: "p"
+        )
+        let xs = try #require(line.strokeOutline()).points.map(\.x)
+
+        #expect(xs.min() == 5 && xs.max() == 95)
+    }
+
+    @Test("Splits dashed strokes into one outline per dash")
+    func splitsDashes() throws {
+        let line = try path(
+            #"<path id="p" d="M0 50 H100" stroke="black" stroke-width="4" stroke-dasharray="10 10"/>"#,
+            id: "p"
+        )
+        let outline = try #require(line.strokeOutline())
+        let moves = outline.verbs.filter { $0 == UInt8(SegmentType.moveTo.rawValue) }
+
+        #expect(moves.count == 5)
+    }
+
+    @Test("Returns nil without a stroke")
+    func nilWithoutStroke() throws {
+        let rect = try path(#"<rect id="r" width="10" height="10"/>"#, id: "r")
+
+        #expect(try rect.strokeOutline() == nil)
+    }
+
+    @Test("Throws for an invalid resolution")
+    func throwsForInvalidResolution() throws {
+        let line = try path(#"<path id="p" d="M10 50 H90" stroke="black" stroke-width="10"/>"#, id: "p")
+
+        #expect(throws: ResvgError.invalidResolution(0)) {
+            try line.strokeOutline(resolution: 0)
+        }
+        #expect(throws: ResvgError.invalidResolution(.infinity)) {
+            try line.strokeOutline(resolution: .infinity)
+        }
+    }
+}
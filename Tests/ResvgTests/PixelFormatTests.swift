@@ -0,0 +1,90 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("PixelFormat Tests")
+struct PixelFormatTests {
+    /// The original per-pixel implementation, kept as the bit-exact reference.
+    func referenceUnpremultiply(_ rgba: inout [UInt8]) {
+        let pixelCount = rgba.count / 4
+        for i in 0 ..< pixelCount {
+            let offset = i * 4
+            let alpha = rgba[offset + 3]
+
+            if alpha > 0, alpha < 255 {
+                let alphaFloat = Float(alpha) / 255.0
+                rgba[offset] = UInt8(min(255, Float(rgba[offset]) / alphaFloat))
+                rgba[offset + 1] = UInt8(min(255, Float(rgba[offset + 1]) / alphaFloat))
+                rgba[offset + 2] = UInt8(min(255, Float(rgba[offset + 2]) / alphaFloat))
+            }
+        }
+    }
+
+    /// Every (value, alpha) combination, plus a 3-pixel tail to cover the scalar path.
+    func allCombinations() -> [UInt8] {
+        var pixels: [UInt8] = []
+        pixels.reserveCapacity((256 * 256 + 3) * 4)
+        for alpha in 0 ..< 256 {
+            for value in 0 ..< 256 {
+                pixels += [UInt8(value), UInt8(255 - value), UInt8(value / 2), UInt8(alpha)]
+            }
+        }
+        pixels += [10, 20, 30, 40, 0, 0, 0, 0, 255, 128, 1, 255]
+        return pixels
+    }
+
+    @Test("Unpremultiply matches reference bit-exactly")
+    func unpremultiplyMatchesReference() {
+        var expected = allCombinations()
+        referenceUnpremultiply(&expected)
+
+        var actual = allCombinations()
+        actual.withUnsafeMutableBytes { PixelFormat.straightRGBA.convertFromPremultipliedRGBA($0) }
+
+        #expect(actual == expected)
+    }
+
+    @Test("BGRA output swaps red and blue")
+    func bgraSwapsChannels() {
+        var expected = allCombinations()
+        referenceUnpremultiply(&expected)
+        for offset in stride(from: 0, to: expected.count, by: 4) {
+            expected.swapAt(offset, offset + 2)
+        }
+
+        var actual = allCombinations()
+        actual.withUnsafeMutableBytes { PixelFormat.straightBGRA.convertFromPremultipliedRGBA($0) }
+
+        #expect(actual == expected)
+    }
+
+    @Test("Premultiplied output is untouched")
+    func premultipliedIsUntouched() {
+        let original = allCombinations()
+        var actual = original
+        actual.withUnsafeMutableBytes { PixelFormat.premultipliedRGBA.convertFromPremultipliedRGBA($0) }
+
+        #expect(actual == original)
+    }
+
+    @Test("Rasterizer honors pixel format")
+    func rasterizerHonorsPixelFormat() throws {
+        let svg = """
+            <svg width="4" height="4" xmlns="http://www.w3.org/2000/svg">
+                <rect width="4" height="4" fill="#FF0000" fill-opacity="0.5"/>
+            </svg>
+            """
+        let rasterizer = SvgRasterizer()
+        let straight = try rasterizer.rasterize(data: Data(svg.utf8))
+        let premultiplied = try rasterizer.rasterize(data: Data(svg.utf8), pixelFormat: .premultipliedRGBA)
+        let bgra = try rasterizer.rasterize(data: Data(svg.utf8), pixelFormat: .straightBGRA)
+
+        #expect(straight.pixelFormat == .straightRGBA)
+        #expect(premultiplied.pixelFormat == .premultipliedRGBA)
+        #expect(straight.rgba[0] > 250)
+        #expect(premultiplied.rgba[0] < 200)
+        #expect(bgra.rgba[2] == straight.rgba[0])
+        #expect(bgra.rgba[0] == straight.rgba[2])
+    }
+}
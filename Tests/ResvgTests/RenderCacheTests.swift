@@ -0,0 +1,96 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("RenderCache Tests")
+struct RenderCacheTests {
+    let svg = Data("""
+        <svg width="10" height="10" xmlns="http://www.w3.org/2000/svg">
+            <circle cx="5" cy="5" r="5" fill="purple"/>
+        </svg>
+        """.utf8)
+
+    @Test("Serves repeated renders from memory")
+    func servesRepeatedRenders() throws {
+        let cache = try RenderCache()
+        let rasterizer = SvgRasterizer(cache: cache)
+
+        let first = try rasterizer.rasterize(data: svg)
+        let second = try rasterizer.rasterize(data: svg)
+        _ = try rasterizer.rasterize(data: svg, scale: 2.0)
+
+        #expect(second.rgba == first.rgba)
+        #expect(cache.statistics.hits == 1)
+        #expect(cache.statistics.misses == 2)
+        #expect(cache.statistics.entryCount == 2)
+    }
+
+    @Test("Keys entries by options")
+    func keysByOptions() throws {
+        let cache = try RenderCache()
+        let context = try RenderContext(options: RenderOptions(dpi: 192))
+
+        _ = try SvgRasterizer(cache: cache).rasterize(data: svg)
+        _ = try SvgRasterizer(context: context, cache: cache).rasterize(data: svg)
+
+        #expect(cache.statistics.hits == 0)
+        #expect(cache.statistics.misses == 2)
+    }
+
+    @Test("Evicts least recently used entries")
+    func evictsLeastRecentlyUsed() throws {
+        // Room for two 10x10 images.
+        let cache = try RenderCache(memoryLimit: 2 * 10 * 10 * 4)
+        let rasterizer = SvgRasterizer(cache: cache)
+
+        _ = try rasterizer.rasterize(data: svg)
+        _ = try rasterizer.rasterize(data: svg, pixelFormat: .straightBGRA)
+        _ = try rasterizer.rasterize(data: svg)
+        _ = try rasterizer.rasterize(data: svg, pixelFormat: .premultipliedRGBA)
+        _ = try rasterizer.rasterize(data: svg)
+
+        #expect(cache.statistics.evictions == 1)
+        #expect(cache.statistics.hits == 2)
+        #expect(cache.statistics.byteCount == 2 * 10 * 10 * 4)
+    }
+
+    @Test("Reads entries back from disk")
+    func readsFromDisk() throws {
+        let directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("resvg-cache-\(UUID().uuidString)")
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        let expected = try SvgRasterizer(cache: try RenderCache(directory: directory)).rasterize(data: svg)
+
+        let cache = try RenderCache(directory: directory)
+        let image = try SvgRasterizer(cache: cache).rasterize(data: svg)
+
+        #expect(image.rgba == expected.rgba)
+        #expect(image.width == 10)
+        #expect(cache.statistics.diskHits == 1)
+        #expect(cache.statistics.misses == 0)
+    }
+
+    @Test("Treats corrupt disk entries as misses")
+    func ignoresCorruptFiles() throws {
+        let directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("resvg-cache-\(UUID().uuidString)")
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        let expected = try SvgRasterizer(cache: try RenderCache(directory: directory)).rasterize(data: svg)
+        let file = try #require(try FileManager.default.contentsOfDirectory(at: directory, includingPropertiesForKeys: nil).first)
+        // Valid magic and format, but a width and height whose byte count overflows.
+        var header = try Data(contentsOf: file).prefix(16)
+        header.replaceSubrange(4 ..< 12, with: [UInt8](repeating: 0xFF, count: 8))
+        try header.write(to: file)
+
+        let cache = try RenderCache(directory: directory)
+        let image = try SvgRasterizer(cache: cache).rasterize(data: svg)
+
+        #expect(image.rgba == expected.rgba)
+        #expect(cache.statistics.diskHits == 0)
+        #expect(cache.statistics.misses == 1)
+        #expect(try Data(contentsOf: file).count == 16 + expected.byteCount)
+    }
+}
@@ -0,0 +1,134 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("RenderContext Tests")
+struct RenderContextTests {
+    let inchSvg = """
+        <svg width="1in" height="1in" xmlns="http://www.w3.org/2000/svg">
+            <rect width="100%" height="100%" fill="red"/>
+        </svg>
+        """
+
+    @Test("Default context uses resvg defaults")
+    func defaultContext() throws {
+        let result = try SvgRasterizer().rasterize(data: Data(inchSvg.utf8))
+
+        #expect(result.width == 96)
+        #expect(result.height == 96)
+    }
+
+    @Test("Applies DPI")
+    func appliesDpi() throws {
+        let context = try RenderContext(options: RenderOptions(dpi: 192))
+        let result = try SvgRasterizer(context: context).rasterize(data: Data(inchSvg.utf8))
+
+        #expect(result.width == 192)
+        #expect(result.height == 192)
+    }
+
+    @Test("Applies stylesheet")
+    func appliesStylesheet() throws {
+        let svg = """
+            <svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">
+                <rect width="100" height="100"/>
+            </svg>
+            """
+        let context = try RenderContext(options: RenderOptions(stylesheet: "rect { fill: #0000FF }"))
+        let tree = try SvgTree(data: Data(svg.utf8), context: context)
+
+        for child in tree.root.children {
+            if let path = child.asPath(), let fill = path.fill {
+                #expect(fill.color == Color(r: 0, g: 0, b: 255))
+                return
+            }
+        }
+        Issue.record("No filled path found")
+    }
+
+    @Test("Shares one context across entry points")
+    func sharesContext() throws {
+        let context = try RenderContext(options: RenderOptions(dpi: 192, languages: ["en", "de"]))
+        let data = Data(inchSvg.utf8)
+
+        let tree = try SvgTree(data: data, context: context)
+        let image = try SvgRasterizer(context: context).rasterize(data: data)
+        let normalized = try SvgNormalizer(context: context).normalize(data)
+
+        #expect(tree.context === context)
+        #expect(tree.size.width == 192)
+        #expect(image.width == 192)
+        #expect(!normalized.isEmpty)
+    }
+
+    @Test("Shares one context across threads")
+    func sharesContextAcrossThreads() async throws {
+        let rasterizer = SvgRasterizer(context: try RenderContext())
+        let data = Data(inchSvg.utf8)
+
+        try await withThrowingTaskGroup(of: Int.self) { group in
+            for _ in 0 ..< 8 {
+                group.addTask { try rasterizer.rasterize(data: data).width }
+            }
+            for try await width in group {
+                #expect(width == 96)
+            }
+        }
+    }
+
+    @Test("Preview quality renders aliased edges")
+    func previewQualityIsAliased() throws {
+        let svg = """
+            <svg width="64" height="64" xmlns="http://www.w3.org/2000/svg">
+                <circle cx="32" cy="32" r="25" fill="black"/>
+            </svg>
+            """
+        let data = Data(svg.utf8)
+        let alphas = { (rasterizer: SvgRasterizer) throws -> Set<UInt8> in
+            let image = try rasterizer.rasterize(data: data)
+            return Set(stride(from: 3, to: image.rgba.count, by: 4).map { image.rgba[$0] })
+        }
+
+        #expect(try alphas(SvgRasterizer(quality: .preview)) == [0, 255])
+        #expect(try alphas(SvgRasterizer(quality: .balanced)).count > 2)
+        #expect(try alphas(SvgRasterizer(quality: .best)).count > 2)
+    }
+
+    @Test("Explicit rendering modes override quality")
+    func explicitModesOverrideQuality() throws {
+        let svg = """
+            <svg width="64" height="64" xmlns="http://www.w3.org/2000/svg">
+                <circle cx="32" cy="32" r="25" fill="black"/>
+            </svg>
+            """
+        let context = try RenderContext(options: RenderOptions(
+            shapeRendering: .geometricPrecision,
+            quality: .preview
+        ))
+        let image = try SvgRasterizer(context: context).rasterize(data: Data(svg.utf8))
+        let alphas = Set(stride(from: 3, to: image.rgba.count, by: 4).map { image.rgba[$0] })
+
+        #expect(alphas.count > 2)
+    }
+
+    @Test("Quality presets are shared")
+    func qualityPresets() {
+        #expect(RenderContext.preset(.best) === RenderContext.default)
+        #expect(RenderContext.preset(.preview) === RenderContext.preset(.preview))
+        #expect(SvgRasterizer(quality: .preview).quality == .preview)
+        #expect(SvgRasterizer().quality == .best)
+        #expect(
+            RenderOptions(quality: .preview).cacheDigest != RenderOptions(quality: .best).cacheDigest
+        )
+    }
+
+    @Test("Throws on missing font file")
+    func throwsOnMissingFontFile() throws {
+        let missing = URL(fileURLWithPath: "/nonexistent/font.ttf")
+
+        #expect(throws: ResvgError.fileOpenFailed(path: missing.path)) {
+            try RenderContext(options: RenderOptions(fontFiles: [missing]))
+        }
+    }
+}
@@ -0,0 +1,93 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("RenderMetrics Tests")
+struct RenderMetricsTests {
+    let svg = Data("""
+        <svg width="100" height="50" xmlns="http://www.w3.org/2000/svg">
+            <g><rect width="100" height="50" fill="red"/><circle cx="25" cy="25" r="20"/></g>
+        </svg>
+        """.utf8)
+
+    /// Collects the metrics reported to a handler.
+    final class Collector: @unchecked Sendable {
+        private let lock = NSLock()
+        private var reports: [RenderMetrics] = []
+
+        var all: [RenderMetrics] { lock.withLock { reports } }
+
+        func handler() -> @Sendable (RenderMetrics) -> Void {
+            { metrics in self.lock.withLock { self.reports.append(metrics) } }
+        }
+    }
+
+    @Test("Reports phases, allocation and output for data")
+    func reportsDataRasterization() throws {
+        let collector = Collector()
+        var rasterizer = SvgRasterizer()
+        rasterizer.metricsHandler = collector.handler()
+
+        _ = try rasterizer.rasterize(data: svg, scale: 2)
+
+        let metrics = try #require(collector.all.first)
+        #expect(collector.all.count == 1)
+        #expect(metrics.loadNanoseconds == 0)
+        #expect(metrics.parseNanoseconds > 0)
+        #expect(metrics.renderNanoseconds > 0)
+        #expect(metrics.pixelConversionNanoseconds > 0)
+        #expect(metrics.totalNanoseconds >= metrics.parseNanoseconds + metrics.renderNanoseconds)
+        #expect(metrics.pixmapBytes == 200 * 100 * 4)
+        #expect(metrics.width == 200)
+        #expect(metrics.height == 100)
+        #expect(metrics.nodeCount >= 2)
+        #expect(!metrics.cacheHit)
+    }
+
+    @Test("Times file loading")
+    func reportsFileLoad() throws {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("\(UUID().uuidString).svg")
+        try svg.write(to: url)
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let collector = Collector()
+        var rasterizer = SvgRasterizer()
+        rasterizer.metricsHandler = collector.handler()
+        _ = try rasterizer.rasterize(file: url)
+
+        #expect(collector.all.count == 1)
+        #expect(try #require(collector.all.first).loadNanoseconds > 0)
+    }
+
+    @Test("Skips parsing for trees and reports no allocation into caller memory")
+    func reportsTreeRendering() throws {
+        let collector = Collector()
+        var rasterizer = SvgRasterizer()
+        rasterizer.metricsHandler = collector.handler()
+        let tree = try SvgTree(data: svg)
+
+        var pixels = [UInt8](repeating: 0, count: 100 * 50 * 4)
+        try pixels.withUnsafeMutableBytes { _ = try rasterizer.rasterize(tree: tree, into: $0) }
+
+        let metrics = try #require(collector.all.first)
+        #expect(metrics.parseNanoseconds == 0)
+        #expect(metrics.renderNanoseconds > 0)
+        #expect(metrics.pixmapBytes == 0)
+        #expect(metrics.width == 100)
+        #expect(metrics.height == 50)
+    }
+
+    @Test("Reports cache hits")
+    func reportsCacheHit() throws {
+        let collector = Collector()
+        var rasterizer = SvgRasterizer(cache: try RenderCache())
+        rasterizer.metricsHandler = collector.handler()
+
+        _ = try rasterizer.rasterize(data: svg)
+        _ = try rasterizer.rasterize(data: svg)
+
+        #expect(collector.all.map(\.cacheHit) == [false, true])
+        #expect(collector.all[1].renderNanoseconds == 0)
+    }
+}
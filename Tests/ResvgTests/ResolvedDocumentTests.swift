@@ -0,0 +1,133 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("Resolved Document Tests")
+struct ResolvedDocumentTests {
+    let svg = Data("""
+        <svg width="120" height="80" viewBox="0 0 60 40" xmlns="http://www.w3.org/2000/svg">
+            <style>.accent { fill: #3366FF }</style>
+            <defs>
+                <linearGradient id="g"><stop offset="0" stop-color="red"/><stop offset="1" stop-color="blue"/></linearGradient>
+                <clipPath id="clip"><circle cx="30" cy="20" r="18"/></clipPath>
+                <rect id="tile" width="10" height="10"/>
+            </defs>
+            <rect width="60" height="40" fill="url(#g)" clip-path="url(#clip)"/>
+            <use href="#tile" x="5" y="5" class="accent"/>
+            <path id="wave" d="M0 30 Q15 20 30 30 T60 30" fill="none" stroke="black" stroke-dasharray="4 2"/>
+        </svg>
+        """.utf8)
+
+    /// Largest per-channel difference; coordinates are rewritten in decimal,
+    /// so anti-aliased edges may round differently.
+    private func maxDifference(_ a: RasterizedSvg, _ b: RasterizedSvg) -> Int {
+        guard a.rgba.count == b.rgba.count else { return .max }
+        return zip(a.rgba, b.rgba).map { abs(Int($0) - Int($1)) }.max() ?? 0
+    }
+
+    @Test("Round trip renders the same image")
+    func roundTripRendersIdentically() throws {
+        let tree = try SvgTree(data: svg)
+        let loaded = try SvgTree(resolvedDocument: tree.resolvedDocument())
+        let rasterizer = SvgRasterizer()
+
+        let original = try rasterizer.rasterize(tree: tree)
+        let reloaded = try rasterizer.rasterize(tree: loaded)
+        #expect(loaded.size.width == tree.size.width && loaded.size.height == tree.size.height)
+        #expect(maxDifference(reloaded, original) <= 1)
+        #expect(loaded.node(withID: "wave") != nil)
+    }
+
+    /// A 2x1 PNG.
+    let pngBase64 = "iVBORw0KGgoAAAANSUhEUgAAAAIAAAABCAYAAAD0In+KAAAADklEQVR4nGP4z8AAQg0AD3oDfnfpf5cAAAAASUVORK5CYII="
+
+    static let systemFonts = try? RenderContext(options: RenderOptions(loadsSystemFonts: true))
+
+    /// Whether the machine has fonts to lay out text with.
+    static var hasSystemFonts: Bool {
+        guard let systemFonts else { return false }
+        let tree = try? SvgTree(data: Data(#"<svg xmlns="http://www.w3.org/2000/svg"><text y="10">A</text></svg>"#.utf8), context: systemFonts)
+        return tree.map { !$0.nodes(ofType: .text).isEmpty } ?? false
+    }
+
+    @Test("Keeps filters")
+    func keepsFilters() throws {
+        let tree = try SvgTree(data: Data("""
+            <svg width="40" height="40" xmlns="http://www.w3.org/2000/svg">
+                <filter id="blur"><feGaussianBlur stdDeviation="3"/></filter>
+                <g filter="url(#blur)"><rect x="10" y="10" width="20" height="20" fill="teal"/></g>
+            </svg>
+            """.utf8))
+        let loaded = try SvgTree(resolvedDocument: tree.resolvedDocument())
+
+        let rasterizer = SvgRasterizer()
+        #expect(maxDifference(try rasterizer.rasterize(tree: loaded), try rasterizer.rasterize(tree: tree)) <= 1)
+    }
+
+    @Test("Embeds images with their original bytes")
+    func keepsImages() throws {
+        let tree = try SvgTree(data: Data("""
+            <svg width="20" height="10" xmlns="http://www.w3.org/2000/svg">
+                <image width="20" height="10" href="data:image/png;base64,\(pngBase64)"/>
+            </svg>
+            """.utf8))
+        let loaded = try SvgTree(resolvedDocument: tree.resolvedDocument())
+
+        let image = try #require(loaded.nodes(ofType: .image).first?.asImage())
+        #expect(image.encodedData == Data(base64Encoded: pngBase64))
+        let rasterizer = SvgRasterizer()
+        #expect(maxDifference(try rasterizer.rasterize(tree: loaded), try rasterizer.rasterize(tree: tree)) <= 1)
+    }
+
+    @Test("Turns text into paths", .enabled(if: ResolvedDocumentTests.hasSystemFonts))
+    func flattensText() throws {
+        let context = try #require(Self.systemFonts)
+        let tree = try SvgTree(data: Data("""
+            <svg width="120" height="30" xmlns="http://www.w3.org/2000/svg">
+                <text id="label" x="4" y="20" font-size="16">Resolved</text>
+            </svg>
+            """.utf8), context: context)
+        let loaded = try SvgTree(resolvedDocument: tree.resolvedDocument())
+
+        #expect(!tree.nodes(ofType: .text).isEmpty)
+        #expect(loaded.nodes(ofType: .text).isEmpty)
+        #expect(!loaded.nodes(ofType: .path).isEmpty)
+        let rasterizer = SvgRasterizer()
+        #expect(maxDifference(try rasterizer.rasterize(tree: loaded), try rasterizer.rasterize(tree: tree)) <= 1)
+    }
+
+    @Test("Writes a versioned header")
+    func writesHeader() throws {
+        let data = try SvgTree(data: svg).resolvedDocument()
+
+        #expect(data.prefix(8) == Data("RSVGRDOC".utf8))
+        #expect(data[8 ..< 12] == Data([1, 0, 0, 0]))
+    }
+
+    @Test("Loads a document file")
+    func mapsFile() throws {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("\(UUID().uuidString).rsvgdoc")
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let tree = try SvgTree(data: svg)
+        try tree.writeResolvedDocument(to: url)
+
+        #expect(try Data(contentsOf: url) == tree.resolvedDocument())
+        let loaded = try SvgTree(resolvedDocumentAt: url)
+        #expect(try maxDifference(SvgRasterizer().rasterize(tree: loaded), SvgRasterizer().rasterize(tree: tree)) <= 1)
+    }
+
+    @Test("Rejects foreign, truncated and newer data")
+    func rejectsInvalidData() throws {
+        let data = try SvgTree(data: svg).resolvedDocument()
+        var newer = data
+        newer[8] = 2
+
+        for invalid in [svg, data.prefix(40), newer] {
+            #expect(throws: ResvgError.invalidResolvedDocument) {
+                try SvgTree(resolvedDocument: invalid)
+            }
+        }
+    }
+}
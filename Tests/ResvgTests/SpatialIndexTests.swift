@@ -0,0 +1,70 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("SpatialIndex Tests")
+struct SpatialIndexTests {
+    /// A 40 x 40 grid of 10 x 10 squares on a 20 px pitch, each with ID "rX-Y".
+    let grid: SvgTree = {
+        var svg = #"<svg width="800" height="800" xmlns="http://www.w3.org/2000/svg">"#
+        for y in 0 ..< 40 {
+            for x in 0 ..< 40 {
+                svg += #"<rect id="r\#(x)-\#(y)" x="\#(x * 20)" y="\#(y * 20)" width="10" height="10"/>"#
+            }
+        }
+        svg += "</svg>"
+        return try! SvgTree(data: Data(svg.utf8))
+    }()
+
+    @Test("Indexes every path")
+    func indexesEveryPath() {
+        #expect(SpatialIndex(tree: grid).count == 1600)
+        #expect(SpatialIndex(tree: grid, types: [.image]).count == 0)
+    }
+
+    @Test("Point query returns the node under the point")
+    func pointQuery() {
+        let index = SpatialIndex(tree: grid)
+
+        #expect(index.nodes(atX: 205, y: 45).map(\.id) == ["r10-2"])
+        #expect(index.nodes(atX: 215, y: 45).isEmpty)
+    }
+
+    @Test("Rectangle query matches a linear scan")
+    func rectangleQuery() {
+        let index = SpatialIndex(tree: grid)
+        let rect = Rect(x: 95, y: 130, width: 120, height: 55)
+
+        let snapshot = grid.snapshot()
+        let expected = snapshot.nodes.indices.filter { i in
+            let box = snapshot.nodes[i].boundingBox
+            return snapshot.nodes[i].kind == .path
+                && box.x <= rect.x + rect.width && rect.x <= box.x + box.width
+                && box.y <= rect.y + rect.height && rect.y <= box.y + box.height
+        }
+        #expect(index.nodes(intersecting: rect).map(\.id) == expected.map { snapshot.id(of: $0) })
+        #expect(index.nodes(intersecting: rect).count == 6 * 3)
+    }
+
+    @Test("Region query maps output pixels to canvas coordinates")
+    func regionQuery() {
+        let index = SpatialIndex(tree: grid)
+        let nodes = index.nodes(in: PixelRegion(x: 0, y: 0, width: 60, height: 20), scale: 2)
+
+        #expect(nodes.map(\.id) == ["r0-0", "r1-0"])
+    }
+
+    @Test("Stroke bounds include the stroke width")
+    func strokeBounds() throws {
+        let svg = """
+            <svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">
+                <rect id="box" x="20" y="20" width="60" height="60" fill="none" stroke="black" stroke-width="10"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+
+        #expect(SpatialIndex(tree: tree, bounds: .stroke).nodes(atX: 16, y: 50).count == 1)
+        #expect(SpatialIndex(tree: tree, bounds: .object).nodes(atX: 16, y: 50).isEmpty)
+    }
+}
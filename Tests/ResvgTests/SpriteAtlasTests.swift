@@ -0,0 +1,131 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("Sprite Atlas Tests")
+struct SpriteAtlasTests {
+    let sprite = Data("""
+        <svg width="200" height="100" xmlns="http://www.w3.org/2000/svg">
+            <rect id="red" x="10" y="10" width="40" height="20" fill="#FF0000"/>
+            <rect id="green" x="60" y="10" width="20" height="30" fill="#00FF00"/>
+            <circle id="blue" cx="150" cy="50" r="25" fill="#0000FF"/>
+        </svg>
+        """.utf8)
+
+    @Test("Renders each node into its own region")
+    func rendersEachNode() throws {
+        let tree = try SvgTree(data: sprite)
+        let atlas = try SvgRasterizer().rasterizeAtlas(tree: tree, ids: ["red", "green", "blue"])
+
+        let red = try #require(atlas.regions["red"])
+        let green = try #require(atlas.regions["green"])
+        let blue = try #require(atlas.regions["blue"])
+        #expect([red.width, red.height] == [40, 20])
+        #expect([green.width, green.height] == [20, 30])
+        #expect([blue.width, blue.height] == [50, 50])
+
+        #expect(pixel(atlas.image, x: red.x + 20, y: red.y + 10) == [255, 0, 0, 255])
+        #expect(pixel(atlas.image, x: green.x + 10, y: green.y + 15) == [0, 255, 0, 255])
+        #expect(pixel(atlas.image, x: blue.x + 25, y: blue.y + 25) == [0, 0, 255, 255])
+    }
+
+    @Test("Regions lie inside the atlas and do not overlap")
+    func regionsDoNotOverlap() throws {
+        let tree = try SvgTree(data: sprite)
+        let atlas = try SvgRasterizer().rasterizeAtlas(tree: tree, ids: ["red", "green", "blue"], scale: 2)
+        let regions = Array(atlas.regions.values)
+
+        for region in regions {
+            #expect(region.isContained(inWidth: atlas.image.width, height: atlas.image.height))
+        }
+        for (i, a) in regions.enumerated() {
+            for b in regions[(i + 1)...] {
+                let separate = a.x + a.width < b.x || b.x + b.width < a.x
+                    || a.y + a.height < b.y || b.y + b.height < a.y
+                #expect(separate)
+            }
+        }
+    }
+
+    @Test("Duplicate IDs share one region")
+    func duplicateIDs() throws {
+        let tree = try SvgTree(data: sprite)
+        let atlas = try SvgRasterizer().rasterizeAtlas(tree: tree, ids: ["red", "red"], padding: 0)
+
+        #expect(atlas.regions.count == 1)
+        #expect([atlas.image.width, atlas.image.height] == [40, 20])
+    }
+
+    @Test("Applies ancestor transforms to nested nodes")
+    func nestedTransformedNode() throws {
+        let tree = try SvgTree(data: Data("""
+            <svg width="200" height="100" xmlns="http://www.w3.org/2000/svg">
+                <g transform="translate(100 0) scale(3)">
+                    <g transform="rotate(30 10 10)">
+                        <rect id="nested" x="0" y="0" width="20" height="20" fill="#FF0000"/>
+                    </g>
+                </g>
+                <rect id="plain" x="10" y="10" width="30" height="30" fill="#0000FF"/>
+            </svg>
+            """.utf8))
+        let atlas = try SvgRasterizer().rasterizeAtlas(tree: tree, ids: ["nested", "plain"], padding: 2)
+        let plain = try #require(atlas.regions["plain"])
+        let nested = try #require(atlas.regions["nested"])
+
+        // The rotated, scaled square spans about 82 px; its center is solid red.
+        #expect(nested.width >= 80 && nested.height >= 80)
+        #expect(pixel(atlas.image, x: nested.x + nested.width / 2, y: nested.y + nested.height / 2) == [255, 0, 0, 255])
+
+        var redPixels = 0
+        for y in 0 ..< atlas.image.height {
+            for x in 0 ..< atlas.image.width {
+                let inNested = x >= nested.x && x < nested.x + nested.width && y >= nested.y && y < nested.y + nested.height
+                let inPlain = x >= plain.x && x < plain.x + plain.width && y >= plain.y && y < plain.y + plain.height
+                let color = pixel(atlas.image, x: x, y: y)
+                if !inNested {
+                    #expect(color[0] == 0, "red at (\(x), \(y)) outside the nested slot")
+                } else if color[0] == 255 {
+                    redPixels += 1
+                }
+                if !inPlain {
+                    #expect(color[2] == 0, "blue at (\(x), \(y)) outside the plain slot")
+                }
+            }
+        }
+        // A 60 px square drawn whole, not cropped by the slot.
+        #expect(redPixels > 3400)
+        #expect(pixel(atlas.image, x: plain.x + 15, y: plain.y + 15) == [0, 0, 255, 255])
+    }
+
+    @Test("Throws for empty IDs")
+    func emptyIDs() throws {
+        let tree = try SvgTree(data: sprite)
+
+        #expect(throws: ResvgError.invalidSize) {
+            try SvgRasterizer().rasterizeAtlas(tree: tree, ids: [])
+        }
+    }
+
+    @Test("Throws for unknown IDs")
+    func unknownID() throws {
+        let tree = try SvgTree(data: sprite)
+
+        #expect(throws: ResvgError.nodeNotFound(id: "missing")) {
+            try SvgRasterizer().rasterizeAtlas(tree: tree, ids: ["red", "missing"])
+        }
+    }
+
+    @Test("Shelf packing keeps input order and padding")
+    func shelfPacking() {
+        let sizes = [(width: 10, height: 5), (width: 10, height: 10), (width: 30, height: 8)]
+        let (width, height, slots) = SvgRasterizer.packShelves(sizes, padding: 2)
+
+        #expect(width >= 30)
+        #expect(slots[1].y == 0)
+        for (slot, size) in zip(slots, sizes) {
+            #expect([slot.width, slot.height] == [size.width, size.height])
+            #expect(slot.x + slot.width <= width && slot.y + slot.height <= height)
+        }
+    }
+}
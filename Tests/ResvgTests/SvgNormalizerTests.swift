@@ -0,0 +1,82 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("SvgNormalizer Tests")
+struct SvgNormalizerTests {
+    let svg = Data("""
+        <svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">
+            <g transform="translate(0.123456789 0)">
+                <rect x="10.123456789" width="50" height="50" fill="red"/>
+                <circle cx="75" cy="75" r="25" fill="blue"/>
+            </g>
+        </svg>
+        """.utf8)
+
+    @Test("Default output matches tree export")
+    func defaultMatchesTreeExport() throws {
+        let normalized = try SvgNormalizer().normalizeToString(svg)
+        let exported = try SvgTree(data: svg).toSvgString()
+
+        #expect(normalized == exported)
+    }
+
+    @Test("Minified output has no line breaks and is smaller")
+    func minifiedOutput() throws {
+        let normalizer = SvgNormalizer()
+        let pretty = try normalizer.normalize(svg)
+        let minified = try normalizer.normalize(svg, options: .minified)
+
+        #expect(minified.count < pretty.count)
+        #expect(!String(decoding: minified, as: UTF8.self).trimmingCharacters(in: .newlines).contains("\n"))
+        #expect(try SvgTree(data: minified).root.childCount == SvgTree(data: pretty).root.childCount)
+    }
+
+    @Test("Applies precision and quote options")
+    func appliesOptions() throws {
+        let options = SvgWriteOptions(coordinatesPrecision: 2, usesSingleQuotes: true)
+        let output = try SvgNormalizer().normalizeToString(svg, options: options)
+
+        #expect(!output.contains("123456"))
+        #expect(output.contains("width='100'"))
+    }
+
+    @Test("Streams output in chunks")
+    func streamsChunks() throws {
+        let normalizer = SvgNormalizer()
+        var chunks: [Data] = []
+        try normalizer.normalize(svg, chunkSize: 16) { chunks.append(Data($0)) }
+
+        #expect(chunks.count > 1)
+        #expect(chunks.allSatisfy { $0.count <= 16 })
+        #expect(chunks.reduce(Data(), +) == (try normalizer.normalize(svg)))
+    }
+
+    @Test("Propagates errors thrown while streaming")
+    func propagatesSinkErrors() throws {
+        struct Stop: Error {}
+        var calls = 0
+
+        #expect(throws: Stop.self) {
+            try SvgNormalizer().normalize(svg, chunkSize: 8) { _ in
+                calls += 1
+                throw Stop()
+            }
+        }
+        #expect(calls == 1)
+    }
+
+    @Test("Writes to a file handle")
+    func writesToFileHandle() throws {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("normalize-\(UUID().uuidString).svg")
+        FileManager.default.createFile(atPath: url.path, contents: nil)
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let handle = try FileHandle(forWritingTo: url)
+        try SvgNormalizer().normalize(svg, options: .minified, to: handle)
+        try handle.close()
+
+        #expect(try Data(contentsOf: url) == SvgNormalizer().normalize(svg, options: .minified))
+    }
+}
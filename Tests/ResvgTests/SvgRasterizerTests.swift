@@ -55,6 +55,165 @@ struct SvgRasterizerTests {
         }
     }
 
+    @Test("Rasterizes parsed tree")
+    func rasterizeTree() throws {
+        let svg = """
+            <svg width="50" height="50" xmlns="http://www.w3.org/2000/svg">
+                <circle cx="25" cy="25" r="20" fill="#3366CC" opacity="0.5"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        let fromTree = try rasterizer.rasterize(tree: tree, scale: 2.0)
+        let fromData = try rasterizer.rasterize(data: Data(svg.utf8), scale: 2.0)
+
+        #expect(fromTree.width == 100)
+        #expect(fromTree.rgba == fromData.rgba)
+    }
+
+    @Test("Rasterizes parsed tree at several scales")
+    func rasterizeTreeAtScales() throws {
+        let svg = """
+            <svg width="24" height="24" xmlns="http://www.w3.org/2000/svg">
+                <rect width="24" height="24" fill="red"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        let results = try rasterizer.rasterize(tree: tree, scales: [1, 2, 3])
+
+        #expect(results.map(\.width) == [24, 48, 72])
+        #expect(results.map(\.height) == [24, 48, 72])
+    }
+
+    @Test("Renders into caller buffer with padded rows")
+    func rasterizeIntoPaddedBuffer() throws {
+        let svg = """
+            <svg width="10" height="6" xmlns="http://www.w3.org/2000/svg">
+                <rect width="10" height="6" fill="#00FF00" fill-opacity="0.75"/>
+                <circle cx="5" cy="3" r="3" fill="blue"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        let expected = try rasterizer.rasterize(tree: tree)
+        let bytesPerRow = 64
+        var buffer = [UInt8](repeating: 0xAB, count: bytesPerRow * 6)
+
+        let size = try buffer.withUnsafeMutableBytes {
+            try rasterizer.rasterize(tree: tree, into: $0, bytesPerRow: bytesPerRow)
+        }
+
+        #expect(size.width == 10)
+        #expect(size.height == 6)
+        for row in 0 ..< 6 {
+            let rowStart = row * bytesPerRow
+            #expect(Array(buffer[rowStart ..< rowStart + 40]) == Array(expected.rgba[row * 40 ..< row * 40 + 40]))
+            #expect(buffer[rowStart + 40 ..< rowStart + bytesPerRow].allSatisfy { $0 == 0 })
+        }
+    }
+
+    @Test("Throws when caller buffer is too small")
+    func throwsOnSmallBuffer() throws {
+        let svg = """
+            <svg width="10" height="10" xmlns="http://www.w3.org/2000/svg">
+                <rect width="10" height="10" fill="red"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        var buffer = [UInt8](repeating: 0, count: 100)
+
+        #expect(throws: ResvgError.bufferTooSmall(required: 400, actual: 100)) {
+            try buffer.withUnsafeMutableBytes {
+                try rasterizer.rasterize(tree: tree, into: $0)
+            }
+        }
+        #expect(throws: ResvgError.invalidRowStride(bytesPerRow: 42)) {
+            try buffer.withUnsafeMutableBytes {
+                try rasterizer.rasterize(tree: tree, into: $0, bytesPerRow: 42)
+            }
+        }
+    }
+
+    @Test("Reuses pixel buffer without shrinking")
+    func reusesPixelBuffer() throws {
+        let svg = """
+            <svg width="20" height="20" xmlns="http://www.w3.org/2000/svg">
+                <rect width="20" height="20" fill="red"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        let buffer = PixelBuffer()
+
+        try rasterizer.rasterize(tree: tree, scale: 2.0, into: buffer)
+        #expect(buffer.width == 40)
+        #expect(buffer.capacity == 40 * 40 * 4)
+        #expect(buffer.makeRasterizedSvg().rgba == (try rasterizer.rasterize(tree: tree, scale: 2.0)).rgba)
+
+        try rasterizer.rasterize(tree: tree, scale: 1.0, into: buffer)
+        #expect(buffer.width == 20)
+        #expect(buffer.byteCount == 20 * 20 * 4)
+        #expect(buffer.capacity == 40 * 40 * 4)
+    }
+
+    @Test("Rasterizes region matching full render")
+    func rasterizeRegion() throws {
+        let svg = """
+            <svg width="40" height="30" xmlns="http://www.w3.org/2000/svg">
+                <rect x="5" y="5" width="30" height="20" fill="#FF8000"/>
+                <circle cx="20" cy="15" r="9" fill="blue" fill-opacity="0.5"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        let full = try rasterizer.rasterize(tree: tree, scale: 2.0)
+        let region = PixelRegion(x: 30, y: 14, width: 25, height: 17)
+        let result = try rasterizer.rasterize(tree: tree, scale: 2.0, region: region)
+
+        #expect(result.width == 25)
+        #expect(result.height == 17)
+        for row in 0 ..< region.height {
+            for column in 0 ..< region.width * 4 {
+                let expected = full.rgba[(region.y + row) * full.width * 4 + region.x * 4 + column]
+                let actual = result.rgba[row * region.width * 4 + column]
+                #expect(abs(Int(expected) - Int(actual)) <= 1)
+            }
+        }
+    }
+
+    @Test("Splits image into tiles")
+    func splitsIntoTiles() throws {
+        let svg = """
+            <svg width="100" height="70" xmlns="http://www.w3.org/2000/svg">
+                <rect width="100" height="70" fill="green"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        let tiles = try rasterizer.tiles(of: tree, tileSize: 64)
+
+        #expect(tiles == [
+            PixelRegion(x: 0, y: 0, width: 64, height: 64),
+            PixelRegion(x: 64, y: 0, width: 36, height: 64),
+            PixelRegion(x: 0, y: 64, width: 64, height: 6),
+            PixelRegion(x: 64, y: 64, width: 36, height: 6),
+        ])
+
+        var rendered: [PixelRegion] = []
+        try rasterizer.rasterizeTiles(tree: tree, tileSize: 64) { region, buffer in
+            #expect(buffer.width == region.width)
+            #expect(buffer.height == region.height)
+            rendered.append(region)
+        }
+        #expect(rendered == tiles)
+
+        var whole: [PixelRegion] = []
+        try rasterizer.rasterizeTiles(tree: tree, tileSize: .max) { region, _ in whole.append(region) }
+        #expect(whole == [PixelRegion(x: 0, y: 0, width: 100, height: 70)])
+        #expect(throws: ResvgError.invalidSize) {
+            try rasterizer.rasterizeTiles(tree: tree, tileSize: 0) { _, _ in }
+        }
+
+        #expect(throws: ResvgError.regionOutOfBounds(PixelRegion(x: 90, y: 0, width: 20, height: 10))) {
+            try rasterizer.rasterize(tree: tree, region: PixelRegion(x: 90, y: 0, width: 20, height: 10))
+        }
+    }
+
     @Test("Rasterizes from file")
     func rasterizeFromFile() throws {
         guard let url = testFixtureURL("test", ext: "svg") else {
@@ -66,4 +225,38 @@ struct SvgRasterizerTests {
         #expect(result.width > 0)
         #expect(result.height > 0)
     }
+
+    @Test("Rasterizes large file through mapping")
+    func rasterizeLargeFile() throws {
+        let url = FileManager.default.temporaryDirectory
+            .appendingPathComponent("resvg-large-\(UUID().uuidString).svg")
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        var svg = #"<svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">"#
+        for index in 0 ..< 2000 {
+            svg += ##"<rect x="\##(index % 100)" y="\##(index / 20)" width="1" height="1" fill="#336699"/>"##
+        }
+        svg += "</svg>"
+        try Data(svg.utf8).write(to: url)
+        #expect(svg.utf8.count >= SvgFileLoader.mappingThreshold)
+
+        let fromFile = try rasterizer.rasterize(file: url)
+        let fromData = try rasterizer.rasterize(data: Data(svg.utf8))
+        #expect(fromFile.rgba == fromData.rgba)
+    }
+
+    @Test("Throws fileOpenFailed for missing file")
+    func throwsOnMissingFile() throws {
+        let missing = URL(fileURLWithPath: "/nonexistent/image.svg")
+
+        #expect(throws: ResvgError.fileOpenFailed(path: missing.path)) {
+            try rasterizer.rasterize(file: missing)
+        }
+        #expect(throws: ResvgError.fileOpenFailed(path: missing.path)) {
+            try SvgTree(file: missing)
+        }
+        #expect(throws: ResvgError.fileOpenFailed(path: missing.path)) {
+            try SvgNormalizer().normalize(file: missing)
+        }
+    }
 }
@@ -0,0 +1,107 @@
+import Foundation
+import Testing
+
+@testable import Resvg
+
+@Suite("SvgRecolorer Tests")
+struct SvgRecolorerTests {
+    let svg = Data("""
+        <svg width="4" height="2" xmlns="http://www.w3.org/2000/svg">
+            <defs>
+                <linearGradient id="glow">
+                    <stop offset="0" stop-color="#0000ff"/>
+                    <stop offset="1" stop-color="#00ff00"/>
+                </linearGradient>
+            </defs>
+            <rect id="left" width="2" height="2" fill="#ff0000"/>
+            <rect id="right" x="2" width="2" height="2" fill="url(#glow)"/>
+        </svg>
+        """.utf8)
+
+    let red = Color(r: 255, g: 0, b: 0)
+    let green = Color(r: 0, g: 255, b: 0)
+    let blue = Color(r: 0, g: 0, b: 255)
+
+    private func render(_ overrides: PaintOverrides) throws -> RasterizedSvg {
+        let recolorer = try SvgRecolorer(data: svg)
+        return try SvgRasterizer().rasterize(tree: recolorer.tree(with: overrides))
+    }
+
+    @Test("Without overrides the variant matches the original")
+    func emptyOverrides() throws {
+        let original = try SvgRasterizer().rasterize(data: svg)
+        let variant = try render(PaintOverrides())
+        #expect(variant.width == original.width)
+        #expect(variant.height == original.height)
+        #expect(variant.rgba == original.rgba)
+    }
+
+    @Test("Replaces solid colors")
+    func replacesColors() throws {
+        let image = try render(PaintOverrides(colors: [red: green]))
+        #expect(pixel(image, x: 0, y: 0) == [0, 255, 0, 255])
+    }
+
+    @Test("Replaces gradient references")
+    func replacesPaintServers() throws {
+        var overrides = PaintOverrides()
+        overrides.replace(.paintServer(id: "glow"), with: red)
+        let image = try render(overrides)
+        #expect(pixel(image, x: 3, y: 1) == [255, 0, 0, 255])
+    }
+
+    @Test("Replaces element paints, with later rules winning")
+    func replacesElements() throws {
+        var overrides = PaintOverrides(colors: [red: green])
+        overrides.replace(.element(id: "left"), with: blue)
+        let image = try render(overrides)
+        #expect(pixel(image, x: 0, y: 0) == [0, 0, 255, 255])
+    }
+
+    @Test("Replaces gradient stops of a matched color")
+    func replacesStopColors() throws {
+        let image = try render(PaintOverrides(colors: [blue: red]))
+        let start = pixel(image, x: 2, y: 1)
+        #expect(start[2] == 0)
+        #expect(start[0] > 128)
+    }
+
+    @Test("Leaves mask and clip-path contents alone")
+    func skipsMasksAndClips() throws {
+        let masked = Data("""
+            <svg width="4" height="2" xmlns="http://www.w3.org/2000/svg">
+                <mask id="reveal"><rect width="2" height="2" fill="#ffffff"/></mask>
+                <clipPath id="clip"><rect width="3" height="2" fill="#ffffff"/></clipPath>
+                <g clip-path="url(#clip)">
+                    <rect id="shape" width="4" height="2" fill="#ff0000" mask="url(#reveal)"/>
+                </g>
+            </svg>
+            """.utf8)
+        let recolorer = try SvgRecolorer(data: masked)
+        let white = Color(r: 255, g: 255, b: 255)
+        var overrides = PaintOverrides(colors: [white: Color(r: 0, g: 0, b: 0), red: green])
+        overrides.replace(.element(id: "reveal"), with: Color(r: 0, g: 0, b: 0))
+        let image = try SvgRasterizer().rasterize(tree: recolorer.tree(with: overrides))
+
+        #expect(pixel(image, x: 0, y: 0) == [0, 255, 0, 255])
+        #expect(pixel(image, x: 3, y: 0)[3] == 0)
+    }
+
+    @Test("Sets opacity")
+    func setsOpacity() throws {
+        var overrides = PaintOverrides()
+        overrides.replace(.color(red), opacity: 0.5)
+        let image = try render(overrides)
+        let alpha = Int(pixel(image, x: 0, y: 0)[3])
+        #expect(abs(alpha - 128) <= 1)
+    }
+
+    @Test("Leaves the source tree unchanged")
+    func keepsSourceTree() throws {
+        let recolorer = try SvgRecolorer(data: svg)
+        _ = try recolorer.tree(with: PaintOverrides(colors: [red: green]))
+
+        let image = try SvgRasterizer().rasterize(tree: recolorer.tree)
+        #expect(pixel(image, x: 0, y: 0) == [255, 0, 0, 255])
+    }
+}
@@ -1,5 +1,7 @@
 import Foundation
 
+@testable import Resvg
+
 /// Locates a test fixture file, trying Bundle.module first (macOS/Linux),
 /// then falling back to source-relative path (Windows).
 ///
@@ -21,3 +23,9 @@ func testFixtureURL(
     }
     return nil
 }
+
+/// The four channel bytes of the pixel at (x, y).
+func pixel(_ image: RasterizedSvg, x: Int, y: Int) -> [UInt8] {
+    let offset = (y * image.width + x) * PixelFormat.bytesPerPixel
+    return Array(image.rgba[offset ..< offset + PixelFormat.bytesPerPixel])
+}
@@ -179,6 +179,35 @@ struct TreeTraversalTests {
         }
     }
 
+    @Test("Copies path geometry in bulk")
+    func getPathGeometry() throws {
+        let svg = """
+            <svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">
+                <path d="M10 10 Q50 0 90 10 C90 50 50 90 10 90 Z" fill="red"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+
+        for child in tree.root.children {
+            if child.nodeType == .path, let path = child.asPath() {
+                let geometry = path.geometry
+                #expect(geometry.verbs.count == path.segmentCount)
+                #expect(geometry.points.count == path.pointCount)
+                #expect(geometry.verbs.first == UInt8(SegmentType.moveTo.rawValue))
+                #expect(geometry.verbs.last == UInt8(SegmentType.close.rawValue))
+
+                // Bulk copy must agree with per-index access
+                let segments = geometry.segments
+                #expect(segments.count == path.segmentCount)
+                for (index, segment) in segments.enumerated() {
+                    #expect(path.segment(at: index) == segment)
+                }
+                return
+            }
+        }
+        Issue.record("No path found")
+    }
+
     @Test("Gets path fill")
     func getPathFill() throws {
         let svg = """
@@ -479,4 +508,121 @@ struct TreeTraversalTests {
             }
         }
     }
+
+    // MARK: - Query Tests
+
+    let querySvg = """
+        <svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">
+            <g id="icons" opacity="0.5">
+                <rect id="icon-home" width="10" height="10"/>
+                <circle id="icon-search" cx="30" cy="30" r="5"/>
+            </g>
+            <rect id="icon-home-alt" x="50" width="10" height="10"/>
+        </svg>
+        """
+
+    @Test("Finds nodes by ID")
+    func findsNodeByID() throws {
+        let tree = try SvgTree(data: Data(querySvg.utf8))
+
+        let search = try #require(tree.node(withID: "icon-search"))
+        #expect(search.nodeType == .path)
+        #expect(search.id == "icon-search")
+        #expect(search.asPath()?.hasID("icon-search") == true)
+
+        #expect(tree.node(withID: "icons")?.asGroup()?.opacity == 0.5)
+        #expect(tree.node(withID: "icon-home")?.hasID("icon-home") == true)
+        #expect(tree.node(withID: "icon-home")?.hasID("icon-home-alt") == false)
+        #expect(tree.node(withID: "missing") == nil)
+        #expect(tree.node(withID: "") == nil)
+    }
+
+    @Test("Queries nodes by type and predicate")
+    func queriesNodes() throws {
+        let tree = try SvgTree(data: Data(querySvg.utf8))
+
+        let paths = tree.nodes(ofType: .path)
+        #expect(paths.map(\.id) == ["icon-home", "icon-search", "icon-home-alt"])
+        #expect(tree.nodes(ofType: .group).map(\.id) == ["icons"])
+        #expect(tree.nodes(ofType: .image).isEmpty)
+
+        let homes = tree.nodes(ofType: .path) { $0.id.hasPrefix("icon-home") }
+        #expect(homes.count == 2)
+        #expect(tree.nodes { $0.nodeType != .path }.count == 1)
+    }
+
+    @Test("IDs are decoded by length")
+    func decodesIDsByLength() throws {
+        let svg = """
+            <svg width="10" height="10" xmlns="http://www.w3.org/2000/svg">
+                <rect id="a" width="5" height="5"/>
+                <rect id="ünïcødé" x="5" width="5" height="5"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+
+        #expect(tree.nodes(ofType: .path).map(\.id) == ["a", "ünïcødé"])
+        #expect(tree.node(withID: "ünïcødé")?.asPath()?.id == "ünïcødé")
+    }
+
+    // MARK: - TreeSnapshot Tests
+
+    @Test("Snapshot matches per-node traversal")
+    func snapshotMatchesTraversal() throws {
+        let svg = """
+            <svg width="100" height="100" xmlns="http://www.w3.org/2000/svg">
+                <g id="layer" opacity="0.5" transform="translate(10 20)">
+                    <rect id="box" width="50" height="50" fill="#FF0000" stroke="#0000FF" stroke-width="4"/>
+                    <circle cx="75" cy="75" r="25" fill="#00FF00"/>
+                </g>
+                <rect id="last" x="90" width="10" height="10" fill="#000000"/>
+            </svg>
+            """
+        let tree = try SvgTree(data: Data(svg.utf8))
+        let snapshot = tree.snapshot()
+
+        func count(_ group: Group) -> Int {
+            group.children.reduce(1) { total, child in
+                total + (child.asGroup().map(count) ?? 1)
+            }
+        }
+        #expect(snapshot.nodes.count == count(tree.root))
+
+        let root = snapshot.nodes[TreeSnapshot.rootIndex]
+        #expect(root.kind == .group)
+        #expect(root.parent == nil)
+        #expect(Array(snapshot.children(of: TreeSnapshot.rootIndex)).count == tree.root.childCount)
+
+        let layer = try #require(snapshot.nodes.indices.first { snapshot.id(of: $0) == "layer" })
+        #expect(snapshot.nodes[layer].kind == .group)
+        #expect(snapshot.nodes[layer].opacity == 0.5)
+        #expect(snapshot.nodes[layer].parent == TreeSnapshot.rootIndex)
+
+        let box = try #require(snapshot.nodes.indices.first { snapshot.id(of: $0) == "box" })
+        let node = snapshot.nodes[box]
+        #expect(node.kind == .path)
+        #expect(node.isVisible)
+        #expect(node.parent == layer)
+        #expect(node.transform.e == 10)
+        #expect(node.transform.f == 20)
+        #expect(node.boundingBox == Rect(x: 10, y: 20, width: 50, height: 50))
+        #expect(snapshot.fill(of: box)?.color == Color(r: 255, g: 0, b: 0))
+        #expect(snapshot.stroke(of: box)?.color == Color(r: 0, g: 0, b: 255))
+        #expect(snapshot.stroke(of: box)?.width == 4)
+    }
+
+    @Test("Snapshot outlives its tree")
+    func snapshotOutlivesTree() throws {
+        let svg = """
+            <svg width="10" height="10" xmlns="http://www.w3.org/2000/svg">
+                <rect id="only" width="10" height="10"/>
+            </svg>
+            """
+        let snapshot = try SvgTree(data: Data(svg.utf8)).snapshot()
+
+        #expect(snapshot.nodes.count == 2)
+        #expect(snapshot.id(of: 1) == "only")
+        #expect(snapshot.fill(of: 1)?.color == Color(r: 0, g: 0, b: 0))
+        #expect(snapshot.stroke(of: 1) == nil)
+    }
 }
@@ -983,6 +983,523 @@ resvg_rect resvg_text_bounding_box(const resvg_text *text);
 /** Returns the flattened paths of a text node as a group. */
 const resvg_group* resvg_text_flattened(const resvg_text *text);
 
+// -----------------------------------------------------------------------------
+// Bulk Path Data
+// -----------------------------------------------------------------------------
+
+/** Returns the number of points in a path's data (each point is an x/y pair). */
+uintptr_t resvg_path_data_points_len(const resvg_path *path);
+
+/**
+ * @brief Copies all verbs and points of a path in a single call.
+ *
+ * Verbs use the resvg_path_segment_type values. Points are interleaved x/y pairs
+ * in the order the verbs consume them (MoveTo/LineTo: 1, QuadTo: 2, CubicTo: 3, Close: 0).
+ *
+ * @param path Path.
+ * @param verbs Output buffer of at least resvg_path_data_len bytes.
+ * @param verbs_len Capacity of verbs.
+ * @param points Output buffer of at least resvg_path_data_points_len * 2 floats.
+ * @param points_len Capacity of points, in floats.
+ * @return false if the path is NULL or a buffer is too small.
+ */
+bool resvg_path_data_copy(const resvg_path *path, uint8_t *verbs, uintptr_t verbs_len, float *points, uintptr_t points_len);
+
+// -----------------------------------------------------------------------------
+// Tree Snapshot
+// -----------------------------------------------------------------------------
+
+/** Index value meaning "no node" or "no paint" in a snapshot. */
+#define RESVG_SNAPSHOT_NONE UINT32_MAX
+
+/** Snapshot node flag: the path or image is visible. */
+#define RESVG_SNAPSHOT_VISIBLE 1
+/** Snapshot node flag: the group has a mask. */
+#define RESVG_SNAPSHOT_HAS_MASK 2
+/** Snapshot node flag: the group has a clip path. */
+#define RESVG_SNAPSHOT_HAS_CLIP_PATH 4
+
+/** One node of a tree snapshot. */
+typedef struct {
+    uint32_t parent;         /**< Parent index, or RESVG_SNAPSHOT_NONE for the root. */
+    uint32_t first_child;    /**< First child index, or RESVG_SNAPSHOT_NONE. */
+    uint32_t next_sibling;   /**< Next sibling index, or RESVG_SNAPSHOT_NONE. */
+    uint32_t id_offset;      /**< Offset of the ID in the string blob. */
+    uint32_t id_len;         /**< Length of the ID in bytes (not NUL-terminated). */
+    uint32_t fill;           /**< Fill paint index, or RESVG_SNAPSHOT_NONE. */
+    uint32_t stroke;         /**< Stroke paint index, or RESVG_SNAPSHOT_NONE. */
+    uint8_t kind;            /**< A resvg_node_type value. */
+    uint8_t flags;           /**< RESVG_SNAPSHOT_* flags. */
+    uint8_t reserved[2];
+    float opacity;           /**< Group opacity; 1 for other nodes. */
+    resvg_transform transform; /**< Absolute transform. */
+    resvg_rect bbox;         /**< Absolute bounding box (fill only, no stroke). */
+} resvg_snapshot_node;
+
+/** One fill or stroke of a tree snapshot. */
+typedef struct {
+    uint8_t paint_type;      /**< A resvg_paint_type value. */
+    uint8_t reserved[3];
+    resvg_color color;       /**< Solid color; black for gradients and patterns. */
+    float opacity;
+    float width;             /**< Stroke width; 0 for fills. */
+} resvg_snapshot_paint;
+
+/** Opaque snapshot (owned, free with resvg_tree_snapshot_destroy) */
+typedef struct resvg_tree_snapshot resvg_tree_snapshot;
+
+/**
+ * @brief Copies the whole render tree into flat node, paint and string tables.
+ *
+ * Nodes are in preorder with the root group at index 0. The snapshot does not
+ * borrow from the tree and may outlive it.
+ *
+ * @param tree Render tree.
+ * @return Snapshot, or NULL if the tree is NULL. Free with resvg_tree_snapshot_destroy.
+ */
+resvg_tree_snapshot* resvg_tree_snapshot_create(const resvg_render_tree *tree);
+
+/** Frees a snapshot created by resvg_tree_snapshot_create. */
+void resvg_tree_snapshot_destroy(resvg_tree_snapshot *snapshot);
+
+/** Returns the node table of a snapshot and its length in `len`. */
+const resvg_snapshot_node* resvg_tree_snapshot_nodes(const resvg_tree_snapshot *snapshot, uintptr_t *len);
+
+/** Returns the paint table of a snapshot and its length in `len`. */
+const resvg_snapshot_paint* resvg_tree_snapshot_paints(const resvg_tree_snapshot *snapshot, uintptr_t *len);
+
+/** Returns the ID string blob of a snapshot and its length in `len`. */
+const uint8_t* resvg_tree_snapshot_strings(const resvg_tree_snapshot *snapshot, uintptr_t *len);
+
+// -----------------------------------------------------------------------------
+// Node Queries
+// -----------------------------------------------------------------------------
+
+/** Opaque node list (owned, free with resvg_node_list_destroy) */
+typedef struct resvg_node_list resvg_node_list;
+
+/**
+ * @brief Collects every node below the root whose type is in `type_mask`, in preorder.
+ *
+ * @param tree Render tree.
+ * @param type_mask Bit (1 << resvg_node_type) selects a node type.
+ * @return Node list, or NULL if the tree is NULL. Free with resvg_node_list_destroy.
+ */
+resvg_node_list* resvg_tree_collect_nodes(const resvg_render_tree *tree, uint32_t type_mask);
+
+/** Returns the node pointers of a list and their count in `len` (borrowed from the tree). */
+const resvg_node* const* resvg_node_list_items(const resvg_node_list *list, uintptr_t *len);
+
+/** Frees a list created by resvg_tree_collect_nodes. */
+void resvg_node_list_destroy(resvg_node_list *list);
+
+/** Returns the ID of any node and its length in `len`. The string is not NUL-terminated. */
+const char* resvg_node_id(const resvg_node *node, uintptr_t *len);
+
+// -----------------------------------------------------------------------------
+// Streaming SVG Export
+// -----------------------------------------------------------------------------
+
+/** Indentation value: no line breaks or indentation. */
+#define RESVG_INDENT_NONE -1
+/** Indentation value: one tab per level. */
+#define RESVG_INDENT_TABS -2
+
+/** Options for SVG export, mirroring usvg::WriteOptions. */
+typedef struct {
+    int32_t indent;                /**< Spaces per level, or RESVG_INDENT_NONE / RESVG_INDENT_TABS. */
+    int32_t attributes_indent;     /**< Same values as indent, applied to attributes. */
+    uint8_t coordinates_precision; /**< Decimal places for coordinates. */
+    uint8_t transforms_precision;  /**< Decimal places for transforms. */
+    bool use_single_quote;         /**< Quote attribute values with ' instead of ". */
+    bool preserve_text;            /**< Keep text as text instead of paths. */
+    const char *id_prefix;         /**< NUL-terminated prefix for generated IDs, or NULL. */
+} resvg_write_options;
+
+/** Receives one chunk of exported SVG. Return false to stop the export. */
+typedef bool (*resvg_write_callback)(const uint8_t *data, uintptr_t len, void *context);
+
+/**
+ * @brief Exports the render tree as SVG and passes it to a callback in chunks.
+ *
+ * Unlike resvg_tree_to_svg, no C string copy is made.
+ *
+ * @param tree Render tree.
+ * @param options Export options.
+ * @param chunk_size Maximum chunk size in bytes, or 0 for a single chunk.
+ * @param callback Called for each chunk; the data is only valid during the call.
+ * @param context Passed to the callback.
+ * @return false if an argument is NULL or the callback returned false.
+ */
+bool resvg_tree_write_svg(const resvg_render_tree *tree, const resvg_write_options *options, uintptr_t chunk_size, resvg_write_callback callback, void *context);
+
+// -----------------------------------------------------------------------------
+// Encoded Output
+// -----------------------------------------------------------------------------
+
+/** Output encoding */
+typedef enum {
+    RESVG_ENCODING_PNG = 0,
+    RESVG_ENCODING_QOI = 1,
+} resvg_encoding;
+
+/**
+ * @brief Renders a tree and encodes the result without returning raw pixels.
+ *
+ * Pixels are unpremultiplied and encoded on the native side.
+ *
+ * @param tree Render tree.
+ * @param transform Transform applied to the tree.
+ * @param width Output width in pixels.
+ * @param height Output height in pixels.
+ * @param encoding Output encoding.
+ * @param compression PNG compression: 0 = fast, 1 = default, 2 = best. Ignored for QOI.
+ * @param len Receives the encoded length in bytes.
+ * @return Encoded bytes, or NULL on error. Free with resvg_encoded_destroy.
+ */
+uint8_t* resvg_render_encoded(const resvg_render_tree *tree, resvg_transform transform, uint32_t width, uint32_t height, resvg_encoding encoding, uint32_t compression, uintptr_t *len);
+
+/** Frees data returned by resvg_render_encoded. */
+void resvg_encoded_destroy(uint8_t *data, uintptr_t len);
+
+// -----------------------------------------------------------------------------
+// Node Layer Bounds
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Returns node's layer bounding box in canvas coordinates by ID.
+ *
+ * This is the box `resvg_render_node` moves to the pixmap origin: the stroke
+ * bounding box extended by filters.
+ *
+ * @param tree Render tree.
+ * @param id Node's ID. Must not be NULL.
+ * @param bbox Node's layer bounding box.
+ * @return `false` if a node with such an ID does not exist or renders nothing.
+ * @return `false` if ID isn't a non-empty UTF-8 string.
+ */
+bool resvg_get_node_layer_bbox(const resvg_render_tree *tree, const char *id, resvg_rect *bbox);
+
+// -----------------------------------------------------------------------------
+// Node Bounds
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Writes the bounding box of each node in a list, in canvas coordinates.
+ *
+ * @param list Node list.
+ * @param stroke Use the stroke bounding box instead of the object bounding box.
+ * @param boxes Receives one rect per node, in list order.
+ * @param boxes_len Capacity of `boxes` in rects.
+ * @return false if an argument is NULL or `boxes` is too small.
+ */
+bool resvg_node_list_bboxes(const resvg_node_list *list, bool stroke, resvg_rect *boxes, uintptr_t boxes_len);
+
+// -----------------------------------------------------------------------------
+// Path Flattening and Tessellation
+// -----------------------------------------------------------------------------
+
+/** Opaque polylines (owned, free with resvg_polylines_destroy) */
+typedef struct resvg_polylines resvg_polylines;
+
+/** Opaque indexed triangles (owned, free with resvg_triangles_destroy) */
+typedef struct resvg_triangles resvg_triangles;
+
+/**
+ * @brief Flattens a path's curves into one polyline per subpath.
+ *
+ * @param path Path.
+ * @param tolerance Maximum distance between the polyline and the curve.
+ * @param absolute Map points through the path's absolute transform.
+ * @return Polylines, or NULL if the path is NULL or tolerance is not positive.
+ *         Free with resvg_polylines_destroy.
+ */
+resvg_polylines* resvg_path_flatten(const resvg_path *path, float tolerance, bool absolute);
+
+/** Returns the interleaved x/y points of all polylines; `len` receives the float count. */
+const float* resvg_polylines_points(const resvg_polylines *polylines, uintptr_t *len);
+
+/** Returns the first point index of each polyline; `len` receives the polyline count. */
+const uint32_t* resvg_polylines_starts(const resvg_polylines *polylines, uintptr_t *len);
+
+/** Returns 1 for each closed polyline and 0 for each open one; `len` receives the count. */
+const uint8_t* resvg_polylines_closed(const resvg_polylines *polylines, uintptr_t *len);
+
+/** Frees polylines created by resvg_path_flatten. */
+void resvg_polylines_destroy(resvg_polylines *polylines);
+
+/**
+ * @brief Tessellates the fill area of a path into indexed triangles.
+ *
+ * @param path Path.
+ * @param tolerance Maximum distance between flattened edges and the curves.
+ * @param fill_rule Rule deciding which regions are inside.
+ * @param absolute Map vertices through the path's absolute transform.
+ * @return Triangles, or NULL if the path is NULL, tolerance is not positive or
+ *         tessellation fails. Free with resvg_triangles_destroy.
+ */
+resvg_triangles* resvg_path_triangulate(const resvg_path *path, float tolerance, resvg_fill_rule fill_rule, bool absolute);
+
+/** Returns the interleaved x/y vertices; `len` receives the float count. */
+const float* resvg_triangles_vertices(const resvg_triangles *triangles, uintptr_t *len);
+
+/** Returns three vertex indices per triangle; `len` receives the index count. */
+const uint32_t* resvg_triangles_indices(const resvg_triangles *triangles, uintptr_t *len);
+
+/** Frees triangles created by resvg_path_triangulate. */
+void resvg_triangles_destroy(resvg_triangles *triangles);
+
+// -----------------------------------------------------------------------------
+// Stroke Outline
+// -----------------------------------------------------------------------------
+
+/** Opaque path data (owned, free with resvg_path_outline_destroy) */
+typedef struct resvg_path_outline resvg_path_outline;
+
+/**
+ * @brief Returns the filled outline of a path's stroke, with dashes, caps and joins applied.
+ *
+ * Verbs and points use the layout of resvg_path_data_copy.
+ *
+ * @param path Path.
+ * @param resolution_scale Scale the outline will be displayed at; larger values
+ *        produce finer round joins and caps. Must be positive and finite.
+ * @return Outline, or NULL if resolution_scale is invalid, the path has no
+ *         stroke or the stroke is empty.
+ *         Free with resvg_path_outline_destroy.
+ */
+resvg_path_outline* resvg_path_stroke_outline(const resvg_path *path, float resolution_scale);
+
+/** Returns the verbs of an outline; `len` receives the verb count. */
+const uint8_t* resvg_path_outline_verbs(const resvg_path_outline *outline, uintptr_t *len);
+
+/** Returns the interleaved x/y points of an outline; `len` receives the float count. */
+const float* resvg_path_outline_points(const resvg_path_outline *outline, uintptr_t *len);
+
+/** Frees an outline created by resvg_path_stroke_outline. */
+void resvg_path_outline_destroy(resvg_path_outline *outline);
+
+// -----------------------------------------------------------------------------
+// Image Loading
+// -----------------------------------------------------------------------------
+
+/** Image loading enumeration */
+typedef enum {
+    RESVG_IMAGE_LOADING_EAGER = 0,
+    RESVG_IMAGE_LOADING_SKIP = 1,
+} resvg_image_loading;
+
+/**
+ * @brief Sets how `<image>` elements are resolved while parsing.
+ *
+ * With RESVG_IMAGE_LOADING_SKIP, linked files are not read, nested SVG
+ * documents are not parsed and embedded bytes are released; image elements
+ * are left out of the tree.
+ *
+ * @param opt Options.
+ * @param loading Loading mode (default: RESVG_IMAGE_LOADING_EAGER).
+ */
+void resvg_options_set_image_loading(resvg_options *opt, resvg_image_loading loading);
+
+/**
+ * @brief Returns the encoded bytes of a raster image.
+ *
+ * @param image Image.
+ * @param len Receives the byte count.
+ * @return Bytes valid while the tree is alive, or NULL for SVG images.
+ */
+const uint8_t* resvg_image_encoded_data(const resvg_image *image, uintptr_t *len);
+
+/** Opaque decoded pixels (owned, free with resvg_image_pixels_destroy) */
+typedef struct resvg_image_pixels resvg_image_pixels;
+
+/**
+ * @brief Decodes a JPEG, PNG or GIF image to straight RGBA pixels.
+ *
+ * Decodes on every call; nothing is cached in the tree.
+ *
+ * @param image Image.
+ * @return Pixels, or NULL for SVG and WebP images or undecodable data.
+ *         Free with resvg_image_pixels_destroy.
+ */
+resvg_image_pixels* resvg_image_decode(const resvg_image *image);
+
+/** Returns the width of decoded pixels. */
+uint32_t resvg_image_pixels_width(const resvg_image_pixels *pixels);
+
+/** Returns the height of decoded pixels. */
+uint32_t resvg_image_pixels_height(const resvg_image_pixels *pixels);
+
+/** Returns the RGBA bytes of decoded pixels; `len` receives the byte count. */
+const uint8_t* resvg_image_pixels_data(const resvg_image_pixels *pixels, uintptr_t *len);
+
+/** Frees pixels created by resvg_image_decode. */
+void resvg_image_pixels_destroy(resvg_image_pixels *pixels);
+
+// -----------------------------------------------------------------------------
+// Paint Overrides
+// -----------------------------------------------------------------------------
+
+/** Paint override target enumeration */
+typedef enum {
+    RESVG_PAINT_TARGET_COLOR = 0,
+    RESVG_PAINT_TARGET_PAINT_SERVER = 1,
+    RESVG_PAINT_TARGET_ELEMENT = 2,
+} resvg_paint_target;
+
+/** One paint substitution rule */
+typedef struct {
+    /** What the rule matches. */
+    resvg_paint_target target;
+    /** Matched solid color (RESVG_PAINT_TARGET_COLOR); alpha is ignored. */
+    resvg_color color;
+    /** Offset of the gradient, pattern or element ID in the `ids` buffer. */
+    uint32_t id_offset;
+    /** Length of the ID in bytes. */
+    uint32_t id_len;
+    /** Whether matched paints are replaced with `new_color`. */
+    bool replaces_color;
+    /** Replacement color; alpha is ignored. */
+    resvg_color new_color;
+    /** Replacement opacity in 0...1, or negative to keep the current one. */
+    float opacity;
+} resvg_paint_override;
+
+/** Paint server IDs of a parsed tree mapped to the IDs in its source. */
+typedef struct resvg_paint_origins resvg_paint_origins;
+
+/**
+ * @brief Records which source paint server each paint server of a tree came from.
+ *
+ * usvg turns gradients and patterns with objectBoundingBox units into
+ * per-shape copies with generated IDs. The source is parsed again with
+ * user-space units, which keep their IDs, and the paths are matched up.
+ *
+ * @param tree Tree parsed from `data`.
+ * @param data SVG data the tree was parsed from.
+ * @param len Length of `data` in bytes.
+ * @param opt Options the tree was parsed with.
+ * @return Origins, or NULL on error. Free with resvg_paint_origins_destroy.
+ */
+resvg_paint_origins* resvg_paint_origins_create(const resvg_render_tree *tree, const char *data, uintptr_t len, const resvg_options *opt);
+
+/** Frees origins created by resvg_paint_origins_create. */
+void resvg_paint_origins_destroy(resvg_paint_origins *origins);
+
+/**
+ * @brief Returns a copy of a tree with paints replaced.
+ *
+ * Fills, strokes and gradient stops matching a rule are edited on a clone of
+ * the tree, without parsing. Paint server rules match source IDs when
+ * `origins` is given. The contents of masks, clip paths and patterns are left
+ * alone. When several rules match, the last one wins.
+ *
+ * @param tree Source tree.
+ * @param origins Paint origins of `tree`, or NULL to match the tree's IDs.
+ * @param overrides Rules.
+ * @param count Number of rules.
+ * @param ids Concatenated UTF-8 IDs referenced by the rules.
+ * @param ids_len Length of `ids` in bytes.
+ * @return Recolored tree, or NULL on error. Free with resvg_tree_destroy.
+ */
+resvg_render_tree* resvg_tree_recolor(const resvg_render_tree *tree, const resvg_paint_origins *origins, const resvg_paint_override *overrides, uintptr_t count, const char *ids, uintptr_t ids_len);
+
+// -----------------------------------------------------------------------------
+// Render Cost Estimate
+// -----------------------------------------------------------------------------
+
+/** Work a render is expected to do; areas are in output pixels */
+typedef struct {
+    uint32_t groups;
+    uint32_t paths;
+    uint32_t images;
+    uint32_t texts;
+    /** Path segments, counted as verbs. */
+    uint64_t path_segments;
+    /** Fills and strokes painted with a gradient. */
+    uint32_t gradients;
+    /** Fills and strokes painted with a pattern. */
+    uint32_t patterns;
+    uint32_t masks;
+    uint32_t clip_paths;
+    uint32_t filters;
+    /** Groups rendered into an offscreen layer (opacity, clip, mask, filter, blend). */
+    uint32_t layers;
+    /** Area of the output image. */
+    double output_pixels;
+    /** Bounding-box area of every fill and stroke. */
+    double painted_pixels;
+    /** Part of painted_pixels painted with gradients or patterns. */
+    double gradient_pixels;
+    /** Area of all offscreen layers. */
+    double layer_pixels;
+    /** Layer area times the number of filters applied to it. */
+    double filter_pixels;
+    /** Intrinsic pixels of raster images, read from their headers. */
+    uint64_t image_pixels;
+} resvg_render_cost;
+
+/**
+ * @brief Estimates the work of rendering a tree in one traversal.
+ *
+ * Descends into clip paths, masks, patterns, text and nested SVG images.
+ * Nothing is rendered or decoded.
+ *
+ * @param tree Render tree.
+ * @param scale Output scale.
+ * @param cost Receives the estimate.
+ * @return false if `tree` or `cost` is NULL or `scale` is not positive.
+ */
+bool resvg_tree_render_cost(const resvg_render_tree *tree, float scale, resvg_render_cost *cost);
+
+// -----------------------------------------------------------------------------
+// Interruptible Rendering
+// -----------------------------------------------------------------------------
+
+/** Asked before each node is drawn. Return false to stop rendering. */
+typedef bool (*resvg_render_callback)(void *context);
+
+/**
+ * @brief Renders like resvg_render, asking a callback before each node is drawn.
+ *
+ * The output matches resvg_render exactly. Isolated groups (opacity, masks,
+ * clipping, filters) are drawn whole.
+ *
+ * @param tree Render tree.
+ * @param transform Root transform.
+ * @param width Pixmap width.
+ * @param height Pixmap height.
+ * @param pixmap Pixmap data. Should have width*height*4 size and contain
+ *               premultiplied RGBA8888 pixels.
+ * @param callback Called before each node; return false to stop.
+ * @param context Passed to the callback.
+ * @return false if an argument is NULL, the size is zero or the callback returned false.
+ */
+bool resvg_render_interruptible(const resvg_render_tree *tree, resvg_transform transform, uint32_t width, uint32_t height, char *pixmap, resvg_render_callback callback, void *context);
+
+// -----------------------------------------------------------------------------
+// Node Rendering In Place
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Renders a node by ID with the transforms of its ancestors applied.
+ *
+ * Unlike resvg_render_node, the node is drawn where it is on the canvas,
+ * moved so its layer bounding box (see resvg_get_node_layer_bbox) starts at
+ * the pixmap origin, and then `transform` is applied.
+ *
+ * @param tree Render tree.
+ * @param id Node ID (UTF-8, null-terminated).
+ * @param transform Transform applied after moving the layer box to the origin.
+ * @param width Pixmap width.
+ * @param height Pixmap height.
+ * @param pixmap Pixmap data. Should have width*height*4 size and contain
+ *               premultiplied RGBA8888 pixels.
+ * @return false if an argument is NULL, the ID is unknown, the node renders
+ *         nothing or the size is zero.
+ */
+bool resvg_render_node_in_place(const resvg_render_tree *tree, const char *id, resvg_transform transform, uint32_t width, uint32_t height, char *pixmap);
+
 
 #ifdef __cplusplus
 } // extern "C"